@@ -0,0 +1,258 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeBenchmark.c
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Benchmark of the arithmetic and lookup table calendar backends.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+/* Header includes -----------------------------------------------------------*/
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "DateTime.h"
+#include "DateTimeTable.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/* Macro definitions ---------------------------------------------------------*/
+#define REPEAT (5) /*!< Passes per measurement, the fastest is reported. */
+
+/* Type definitions ----------------------------------------------------------*/
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+static volatile double sink = 0.0; /*!< Keeps the results alive. */
+
+/* Function declarations -----------------------------------------------------*/
+static double MonotonicTime(void);
+static unsigned int Random(unsigned int *state);
+static double BenchEncode(const DateTime *time, int count, double (*encode)(DateTime));
+static double BenchAddMonth(const DateTime *time, const int *month, int count, DateTime (*add)(DateTime, int));
+static double BenchDecode(const double *jd, int count, DateTime (*decode)(double));
+
+/* Function definitions ------------------------------------------------------*/
+
+/**
+  * @brief  Main program.
+  * @param  [in] argc: The number of arguments.
+  * @param  [in] argv: [first year] [last year] [count], default 1980 2100 1000000.
+  * @return 0 on success, 1 on failure.
+  */
+int main(int argc, char *argv[])
+{
+  int firstYear = (argc > 1) ? atoi(argv[1]) : 1980;
+  int lastYear  = (argc > 2) ? atoi(argv[2]) : 2100;
+  int count     = (argc > 3) ? atoi(argv[3]) : 1000000;
+
+  if((count < 1) || (DateTimeTableInit(firstYear, lastYear) != 0))
+  {
+    fprintf(stderr, "usage: %s [first year] [last year, at most %d years] [count]\n",
+            argv[0], DATETIME_TABLE_MAX_YEAR_COUNT);
+    return 1;
+  }
+
+  DateTime *time  = (DateTime *)malloc(sizeof(DateTime) * count);
+  double   *jd    = (double *)malloc(sizeof(double) * count);
+  int      *month = (int *)malloc(sizeof(int) * count);
+
+  if((time == NULL) || (jd == NULL) || (month == NULL))
+  {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  DateTime     first = {.year = firstYear,    .month = 1, .day = 1, .hour = 0, .minute = 0, .second = 0};
+  DateTime     last  = {.year = lastYear + 1, .month = 1, .day = 1, .hour = 0, .minute = 0, .second = 0};
+  double       start = GregorianCalendarDateToJulianDate(first);
+  double       span  = GregorianCalendarDateToJulianDate(last) - start;
+  unsigned int state = 12345;
+
+  /* Random whole seconds in the range, and month steps of up to four years either way. */
+  for(int i = 0; i < count; i++)
+  {
+    unsigned int day    = Random(&state) % (unsigned int)span;
+    unsigned int second = Random(&state) % 86400;
+
+    jd[i]    = start + day + second / 86400.0;
+    time[i]  = JulianDateToGregorianCalendarDate(jd[i]);
+    month[i] = (int)(Random(&state) % 97) - 48;
+  }
+
+  printf("%d random epochs in %d-%d, ns per call, best of %d\n", count, firstYear, lastYear, REPEAT);
+  printf("             arithmetic     table\n");
+  printf("encode       %10.2f %9.2f\n",
+         BenchEncode(time, count, GregorianCalendarDateToJulianDate),
+         BenchEncode(time, count, GregorianCalendarDateToJulianDateTable));
+  printf("add month    %10.2f %9.2f\n",
+         BenchAddMonth(time, month, count, GregorianCalendarDateAddMonth),
+         BenchAddMonth(time, month, count, GregorianCalendarDateAddMonthTable));
+  printf("decode       %10.2f %9.2f\n",
+         BenchDecode(jd, count, JulianDateToGregorianCalendarDate),
+         BenchDecode(jd, count, JulianDateToGregorianCalendarDateTable));
+
+  free(time);
+  free(jd);
+  free(month);
+
+  return 0;
+}
+
+/**
+  * @brief  Monotonic time.
+  * @param  None.
+  * @return Seconds from an arbitrary start.
+  */
+static double MonotonicTime(void)
+{
+#if defined(_WIN32)
+  LARGE_INTEGER counter   = {0};
+  LARGE_INTEGER frequency = {0};
+
+  QueryPerformanceCounter(&counter);
+  QueryPerformanceFrequency(&frequency);
+
+  return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+  struct timespec now = {0};
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return now.tv_sec + now.tv_nsec / 1000000000.0;
+#endif
+}
+
+/**
+  * @brief  Pseudo random number, xorshift.
+  * @param  [in,out] state: Generator state, not 0.
+  * @return Random number.
+  */
+static unsigned int Random(unsigned int *state)
+{
+  *state ^= *state << 13;
+  *state ^= *state >> 17;
+  *state ^= *state << 5;
+
+  return *state;
+}
+
+/**
+  * @brief  Time a date encoder.
+  * @param  [in] time:   Gregorian calendar dates.
+  * @param  [in] count:  The number of dates.
+  * @param  [in] encode: Encoder.
+  * @return Nanoseconds per call.
+  */
+static double BenchEncode(const DateTime *time, int count, double (*encode)(DateTime))
+{
+  double best = 0.0;
+
+  for(int r = 0; r < REPEAT; r++)
+  {
+    double start = MonotonicTime();
+    double sum   = 0.0;
+
+    for(int i = 0; i < count; i++)
+    {
+      sum += encode(time[i]);
+    }
+
+    double elapsed = MonotonicTime() - start;
+
+    sink = sum;
+    best = ((r == 0) || (elapsed < best)) ? elapsed : best;
+  }
+
+  return best * 1000000000.0 / count;
+}
+
+/**
+  * @brief  Time a month adder.
+  * @param  [in] time:  Gregorian calendar dates.
+  * @param  [in] month: Months to add.
+  * @param  [in] count: The number of dates.
+  * @param  [in] add:   Month adder.
+  * @return Nanoseconds per call.
+  */
+static double BenchAddMonth(const DateTime *time, const int *month, int count, DateTime (*add)(DateTime, int))
+{
+  double best = 0.0;
+
+  for(int r = 0; r < REPEAT; r++)
+  {
+    double start = MonotonicTime();
+    int    sum   = 0;
+
+    for(int i = 0; i < count; i++)
+    {
+      DateTime date = add(time[i], month[i]);
+
+      sum += date.month + date.day;
+    }
+
+    double elapsed = MonotonicTime() - start;
+
+    sink = sum;
+    best = ((r == 0) || (elapsed < best)) ? elapsed : best;
+  }
+
+  return best * 1000000000.0 / count;
+}
+
+/**
+  * @brief  Time a date decoder.
+  * @param  [in] jd:     Julian dates.
+  * @param  [in] count:  The number of dates.
+  * @param  [in] decode: Decoder.
+  * @return Nanoseconds per call.
+  */
+static double BenchDecode(const double *jd, int count, DateTime (*decode)(double))
+{
+  double best = 0.0;
+
+  for(int r = 0; r < REPEAT; r++)
+  {
+    double start = MonotonicTime();
+    int    sum   = 0;
+
+    for(int i = 0; i < count; i++)
+    {
+      DateTime date = decode(jd[i]);
+
+      sum += date.year + date.month + date.day + date.second;
+    }
+
+    double elapsed = MonotonicTime() - start;
+
+    sink = sum;
+    best = ((r == 0) || (elapsed < best)) ? elapsed : best;
+  }
+
+  return best * 1000000000.0 / count;
+}
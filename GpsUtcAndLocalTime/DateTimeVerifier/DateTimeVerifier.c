@@ -0,0 +1,453 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeVerifier.c
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Exhaustive round trip verifier for the DateTime module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+/* Header includes -----------------------------------------------------------*/
+#if !defined(_WIN32) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE
+#endif
+
+#include "DateTime.h"
+#include "DateTimeCommon.h"
+#include "DateTimeTable.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/* Macro definitions ---------------------------------------------------------*/
+#define MAX_THREAD       (256)
+#define MAX_REPORT       (10)       /*!< Failures printed per check. */
+
+/* Type definitions ----------------------------------------------------------*/
+typedef enum
+{
+  CHECK_TIMEGM = 0,    /*!< Date decoded from the second count agrees with gmtime() and timegm(). */
+  CHECK_JULIAN_DATE,   /*!< Julian date agrees with the second count. */
+  CHECK_GPS,           /*!< Gps week and second agree with the second count. */
+  CHECK_ROUND_TRIP,    /*!< DateTime -> GPS -> JD -> MJD -> DateTime. */
+  CHECK_JULIAN_DECODE, /*!< JD -> DateTime. */
+  CHECK_MONOTONIC,     /*!< MJD strictly increases every second. */
+  CHECK_TABLE,         /*!< Lookup table backend agrees with the arithmetic one. */
+  CHECK_COUNT
+}Check;
+
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+static const char *checkName[CHECK_COUNT] =
+{
+  "timegm",
+  "julian date",
+  "gps week second",
+  "round trip",
+  "julian decode",
+  "monotonic",
+  "table backend"
+};
+
+static long long          firstDay     = 0;
+static long long          dayCount     = 0;
+static volatile long long nextDay      = 0;
+static long long          failure[CHECK_COUNT];
+static long long          checked      = 0;
+
+#if defined(_WIN32)
+static CRITICAL_SECTION   reportLock;
+#else
+static pthread_mutex_t    reportLock   = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/* Function declarations -----------------------------------------------------*/
+static long long FetchDay(void);
+static void Report(Check check, long long second, DateTime time);
+static void VerifyDay(long long day, long long *count);
+static int Equal(DateTime a, DateTime b);
+static DateTime UnixToDateTime(long long second);
+static long long DateTimeToUnix(DateTime time);
+static int ProcessorCount(void);
+#if defined(_WIN32)
+static DWORD WINAPI Worker(LPVOID argument);
+#else
+static void *Worker(void *argument);
+#endif
+
+/* Function definitions ------------------------------------------------------*/
+
+/**
+  * @brief  Main program.
+  * @param  [in] argc: The number of arguments.
+  * @param  [in] argv: [first year] [last year] [threads], default 1980 2100 and all cores.
+  * @return 0 if every check passed, 1 otherwise.
+  */
+int main(int argc, char *argv[])
+{
+  int firstYear = (argc > 1) ? atoi(argv[1]) : 1980;
+  int lastYear  = (argc > 2) ? atoi(argv[2]) : 2100;
+  int threads   = (argc > 3) ? atoi(argv[3]) : ProcessorCount();
+
+  if((lastYear < firstYear) || (firstYear < 1970))
+  {
+    fprintf(stderr, "usage: %s [first year >= 1970] [last year] [threads]\n", argv[0]);
+    return 1;
+  }
+
+  if(threads < 1)
+  {
+    threads = 1;
+  }
+  else if(threads > MAX_THREAD)
+  {
+    threads = MAX_THREAD;
+  }
+
+  DateTime first = {.year = firstYear,    .month = 1, .day = 1, .hour = 0, .minute = 0, .second = 0};
+  DateTime last  = {.year = lastYear + 1, .month = 1, .day = 1, .hour = 0, .minute = 0, .second = 0};
+
+  firstDay = DateTimeToUnix(first) / 86400;
+  dayCount = DateTimeToUnix(last) / 86400 - firstDay;
+
+  /* The table backend is only checked if the tables cover the whole range. */
+  if(DateTimeTableInit(firstYear, lastYear) != 0)
+  {
+    fprintf(stderr, "cannot build tables for %d-%d, at most %d years\n",
+            firstYear, lastYear, DATETIME_TABLE_MAX_YEAR_COUNT);
+    return 1;
+  }
+
+  printf("Verifying %d-%d, %lld seconds on %d threads\n", firstYear, lastYear, dayCount * 86400, threads);
+
+  time_t start = time(NULL);
+
+#if defined(_WIN32)
+  HANDLE handle[MAX_THREAD];
+
+  InitializeCriticalSection(&reportLock);
+
+  for(int i = 0; i < threads; i++)
+  {
+    handle[i] = CreateThread(NULL, 0, Worker, NULL, 0, NULL);
+
+    if(handle[i] == NULL)
+    {
+      threads = i;
+      break;
+    }
+  }
+
+  if(threads == 0)
+  {
+    fprintf(stderr, "cannot create worker threads\n");
+    return 1;
+  }
+
+  for(int i = 0; i < threads; i += MAXIMUM_WAIT_OBJECTS)
+  {
+    int count = ((threads - i) < MAXIMUM_WAIT_OBJECTS) ? (threads - i) : MAXIMUM_WAIT_OBJECTS;
+
+    WaitForMultipleObjects(count, handle + i, TRUE, INFINITE);
+  }
+#else
+  pthread_t handle[MAX_THREAD];
+
+  for(int i = 0; i < threads; i++)
+  {
+    if(pthread_create(&handle[i], NULL, Worker, NULL) != 0)
+    {
+      threads = i;
+      break;
+    }
+  }
+
+  if(threads == 0)
+  {
+    fprintf(stderr, "cannot create worker threads\n");
+    return 1;
+  }
+
+  for(int i = 0; i < threads; i++)
+  {
+    pthread_join(handle[i], NULL);
+  }
+#endif
+
+  int failed = 0;
+
+  for(int i = 0; i < CHECK_COUNT; i++)
+  {
+    printf("%-16s %lld failures\n", checkName[i], failure[i]);
+
+    if(failure[i] != 0)
+    {
+      failed = 1;
+    }
+  }
+
+  printf("%lld seconds checked in %.0f s\n", checked, difftime(time(NULL), start));
+
+  return failed;
+}
+
+#if defined(_WIN32)
+/**
+  * @brief  Verify days from the work queue until it is empty.
+  * @param  [in] argument: Unused.
+  * @return 0.
+  */
+static DWORD WINAPI Worker(LPVOID argument)
+#else
+/**
+  * @brief  Verify days from the work queue until it is empty.
+  * @param  [in] argument: Unused.
+  * @return NULL.
+  */
+static void *Worker(void *argument)
+#endif
+{
+  long long count = 0;
+  long long day   = 0;
+
+  (void)argument;
+
+  while((day = FetchDay()) < dayCount)
+  {
+    VerifyDay(firstDay + day, &count);
+  }
+
+#if defined(_WIN32)
+  EnterCriticalSection(&reportLock);
+  checked += count;
+  LeaveCriticalSection(&reportLock);
+
+  return 0;
+#else
+  pthread_mutex_lock(&reportLock);
+  checked += count;
+  pthread_mutex_unlock(&reportLock);
+
+  return NULL;
+#endif
+}
+
+/**
+  * @brief  Take the next day from the work queue.
+  * @param  None.
+  * @return Day index from the first day.
+  */
+static long long FetchDay(void)
+{
+#if defined(_WIN32)
+  return InterlockedIncrement64(&nextDay) - 1;
+#else
+  return __atomic_fetch_add(&nextDay, 1, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+  * @brief  Verify every second of one day.
+  * @param  [in]     day:   Days since 1970-01-01.
+  * @param  [in,out] count: The number of seconds checked.
+  * @return None.
+  */
+static void VerifyDay(long long day, long long *count)
+{
+  long long second  = day * 86400;
+  DateTime  time    = UnixToDateTime(second);
+  double    lastMjd = GregorianCalendarDateToModifiedJulianDate(UnixToDateTime(second - 1));
+
+  for(int i = 0; i < 86400; i++, second++)
+  {
+    time.hour   = i / 3600;
+    time.minute = i / 60 % 60;
+    time.second = i % 60;
+
+    /* The library decodes the second count, the C library checks the result. */
+    DateTime decoded = JulianDateToGregorianCalendarDate(UNIX_EPOCH_JD + day + i / 86400.0);
+
+    if(!Equal(decoded, time) || (DateTimeToUnix(decoded) != second))
+    {
+      Report(CHECK_TIMEGM, second, time);
+    }
+
+    double jd = GregorianCalendarDateToJulianDate(time);
+
+    if((long long)((jd - UNIX_EPOCH_JD) * 86400.0 + ((jd >= UNIX_EPOCH_JD) ? 0.5 : -0.5)) != second)
+    {
+      Report(CHECK_JULIAN_DATE, second, time);
+    }
+
+    GpsWeekSecond gps = GregorianCalendarDateToGpsWeekSecond(time);
+    double        mjd = JulianDateToModifiedJulianDate(GpsWeekSecondToJulianDate(gps));
+
+    /* Gps week and second are only defined from the gps epoch on. */
+    if(second >= GPS_EPOCH_UNIX)
+    {
+      if(GpsWeekSecondToGpsSecond(gps) != (second - GPS_EPOCH_UNIX))
+      {
+        Report(CHECK_GPS, second, time);
+      }
+
+      if(!Equal(ModifiedJulianDateToGregorianCalendarDate(mjd), time))
+      {
+        Report(CHECK_ROUND_TRIP, second, time);
+      }
+    }
+    else
+    {
+      mjd = GregorianCalendarDateToModifiedJulianDate(time);
+    }
+
+    if(!Equal(JulianDateToGregorianCalendarDate(jd), time))
+    {
+      Report(CHECK_JULIAN_DECODE, second, time);
+    }
+
+    if(!(mjd > lastMjd))
+    {
+      Report(CHECK_MONOTONIC, second, time);
+    }
+
+    if((GregorianCalendarDateToJulianDateTable(time) != jd) ||
+       !Equal(JulianDateToGregorianCalendarDateTable(jd), JulianDateToGregorianCalendarDate(jd)))
+    {
+      Report(CHECK_TABLE, second, time);
+    }
+
+    lastMjd = mjd;
+  }
+
+  *count += 86400;
+}
+
+/**
+  * @brief  Count a failure and print the first few of each check.
+  * @param  [in] check:  The failed check.
+  * @param  [in] second: Seconds since 1970-01-01.
+  * @param  [in] time:   Gregorian calendar date under test.
+  * @return None.
+  */
+static void Report(Check check, long long second, DateTime time)
+{
+#if defined(_WIN32)
+  EnterCriticalSection(&reportLock);
+#else
+  pthread_mutex_lock(&reportLock);
+#endif
+
+  if(failure[check]++ < MAX_REPORT)
+  {
+    printf("FAIL %-16s unix %lld | %d-%.2d-%.2d %.2d:%.2d:%.2d\n", checkName[check], second,
+           time.year, time.month, time.day, time.hour, time.minute, time.second);
+  }
+
+#if defined(_WIN32)
+  LeaveCriticalSection(&reportLock);
+#else
+  pthread_mutex_unlock(&reportLock);
+#endif
+}
+
+/**
+  * @brief  Compare two gregorian calendar dates.
+  * @param  [in] a: Gregorian calendar date.
+  * @param  [in] b: Gregorian calendar date.
+  * @return 1 if every field is equal, otherwise 0.
+  */
+static int Equal(DateTime a, DateTime b)
+{
+  return (a.year == b.year) && (a.month == b.month) && (a.day == b.day) &&
+         (a.hour == b.hour) && (a.minute == b.minute) && (a.second == b.second);
+}
+
+/**
+  * @brief  Seconds since 1970-01-01 to gregorian calendar date, by the C library.
+  * @param  [in] second: Seconds since 1970-01-01.
+  * @return Gregorian calendar date.
+  */
+static DateTime UnixToDateTime(long long second)
+{
+  time_t    value = (time_t)second;
+  struct tm tm    = {0};
+
+#if defined(_WIN32)
+  gmtime_s(&tm, &value);
+#else
+  gmtime_r(&value, &tm);
+#endif
+
+  DateTime time = {.year = tm.tm_year + 1900, .month = tm.tm_mon + 1, .day = tm.tm_mday,
+                   .hour = tm.tm_hour, .minute = tm.tm_min, .second = tm.tm_sec};
+
+  return time;
+}
+
+/**
+  * @brief  Gregorian calendar date to seconds since 1970-01-01, by the C library.
+  * @param  [in] time: Gregorian calendar date.
+  * @return Seconds since 1970-01-01.
+  */
+static long long DateTimeToUnix(DateTime time)
+{
+  struct tm tm = {0};
+
+  tm.tm_year = time.year - 1900;
+  tm.tm_mon  = time.month - 1;
+  tm.tm_mday = time.day;
+  tm.tm_hour = time.hour;
+  tm.tm_min  = time.minute;
+  tm.tm_sec  = time.second;
+
+#if defined(_WIN32)
+  return (long long)_mkgmtime(&tm);
+#else
+  return (long long)timegm(&tm);
+#endif
+}
+
+/**
+  * @brief  The number of online processors.
+  * @param  None.
+  * @return The number of processors.
+  */
+static int ProcessorCount(void)
+{
+#if defined(_WIN32)
+  SYSTEM_INFO info;
+
+  GetSystemInfo(&info);
+
+  return (int)info.dwNumberOfProcessors;
+#else
+  return (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+}
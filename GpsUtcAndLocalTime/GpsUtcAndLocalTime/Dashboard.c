@@ -0,0 +1,266 @@
+/**
+  ******************************************************************************
+  * @file    Dashboard.c
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Terminal dashboard that redraws only changed characters.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+/* Header includes -----------------------------------------------------------*/
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "Dashboard.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <io.h>
+#include <windows.h>
+#else
+#include <time.h>
+#include <unistd.h>
+#endif
+
+/* Macro definitions ---------------------------------------------------------*/
+#if defined(_WIN32) && !defined(ENABLE_VIRTUAL_TERMINAL_PROCESSING)
+#define ENABLE_VIRTUAL_TERMINAL_PROCESSING (0x0004)
+#endif
+
+/* Unchanged characters shorter than a cursor move are rewritten instead. */
+#define DASHBOARD_GAP (6)
+
+/* Type definitions ----------------------------------------------------------*/
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+static double MonotonicTime(void);
+static int WriteOutput(const char *buffer, size_t size);
+
+/* Function definitions ------------------------------------------------------*/
+
+/**
+  * @brief  Initialize the dashboard.
+  * @param  [out] dashboard: Dashboard.
+  * @return None.
+  */
+void DashboardInit(Dashboard *dashboard)
+{
+  memset(dashboard->current, ' ', sizeof(dashboard->current));
+  memset(dashboard->previous, ' ', sizeof(dashboard->previous));
+
+  dashboard->row        = 0;
+  dashboard->column     = 0;
+  dashboard->drawn      = 0;
+  dashboard->bytes      = 0;
+  dashboard->renderTime = 0.0;
+
+#if defined(_WIN32)
+  HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+  DWORD  mode = 0;
+
+  if(GetConsoleMode(hOut, &mode))
+  {
+    SetConsoleMode(hOut, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+  }
+#endif
+}
+
+/**
+  * @brief  Print a row of the next frame.
+  * @param  [in,out] dashboard: Dashboard.
+  * @param  [in]     row:       Row number, from 0.
+  * @param  [in]     format:    printf style format.
+  * @return None.
+  * @note   Text beyond DASHBOARD_MAX_COLUMN is truncated.
+  */
+void DashboardPrint(Dashboard *dashboard, int row, const char *format, ...)
+{
+  if((row < 0) || (row >= DASHBOARD_MAX_ROW))
+  {
+    return;
+  }
+
+  char    text[DASHBOARD_MAX_COLUMN + 1];
+  va_list args;
+
+  va_start(args, format);
+  int length = vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+
+  if(length < 0)
+  {
+    length = 0;
+  }
+  else if(length > DASHBOARD_MAX_COLUMN)
+  {
+    length = DASHBOARD_MAX_COLUMN;
+  }
+
+  memcpy(dashboard->current[row], text, length);
+  memset(dashboard->current[row] + length, ' ', DASHBOARD_MAX_COLUMN - length);
+
+  if(dashboard->row <= row)
+  {
+    dashboard->row = row + 1;
+  }
+
+  if(dashboard->column < length)
+  {
+    dashboard->column = length;
+  }
+}
+
+/**
+  * @brief  Send the characters that changed since the last frame.
+  * @param  [in,out] dashboard: Dashboard.
+  * @return 0 on success, -1 if writing to the terminal failed.
+  * @note   The whole update is sent with one write, then the size and time
+  *         spent are kept in bytes and renderTime.
+  */
+int DashboardRender(Dashboard *dashboard)
+{
+  double start  = MonotonicTime();
+  char  *output = dashboard->output;
+  size_t size   = 0;
+
+  if(!dashboard->drawn)
+  {
+    memcpy(output, "\x1b[2J", 4);
+    size             = 4;
+    dashboard->drawn = 1;
+  }
+
+  for(int row = 0; row < dashboard->row; row++)
+  {
+    const char *current  = dashboard->current[row];
+    char       *previous = dashboard->previous[row];
+    int         cursor   = -1;
+    int         column   = 0;
+
+    while(column < dashboard->column)
+    {
+      if(current[column] == previous[column])
+      {
+        column++;
+        continue;
+      }
+
+      int end  = column + 1;
+      int last = column + 1;
+
+      while(end < dashboard->column)
+      {
+        if(current[end] != previous[end])
+        {
+          last = end + 1;
+        }
+        else if((end - last) >= DASHBOARD_GAP)
+        {
+          break;
+        }
+
+        end++;
+      }
+
+      if(cursor != column)
+      {
+        size += snprintf(output + size, DASHBOARD_OUTPUT_SIZE - size, "\x1b[%d;%dH", row + 1, column + 1);
+      }
+
+      memcpy(output + size, current + column, last - column);
+      memcpy(previous + column, current + column, last - column);
+
+      size  += last - column;
+      cursor = last;
+      column = last;
+    }
+  }
+
+  int ret = 0;
+
+  if(size > 0)
+  {
+    size += snprintf(output + size, DASHBOARD_OUTPUT_SIZE - size, "\x1b[%d;1H", dashboard->row + 1);
+    ret   = WriteOutput(output, size);
+  }
+
+  dashboard->bytes      = size;
+  dashboard->renderTime = MonotonicTime() - start;
+
+  return ret;
+}
+
+/**
+  * @brief  Read a monotonic clock.
+  * @param  None.
+  * @return Seconds from an arbitrary origin.
+  */
+static double MonotonicTime(void)
+{
+#if defined(_WIN32)
+  LARGE_INTEGER counter   = {0};
+  LARGE_INTEGER frequency = {0};
+
+  QueryPerformanceCounter(&counter);
+  QueryPerformanceFrequency(&frequency);
+
+  return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+  struct timespec now = {0};
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return now.tv_sec + now.tv_nsec / 1000000000.0;
+#endif
+}
+
+/**
+  * @brief  Write a buffer to the standard output.
+  * @param  [in] buffer: Data to write.
+  * @param  [in] size:   The number of bytes to write.
+  * @return 0 on success, -1 on failure.
+  */
+static int WriteOutput(const char *buffer, size_t size)
+{
+  while(size > 0)
+  {
+#if defined(_WIN32)
+    int count = _write(1, buffer, (unsigned int)size);
+#else
+    ssize_t count = write(STDOUT_FILENO, buffer, size);
+#endif
+
+    if(count <= 0)
+    {
+      return -1;
+    }
+
+    buffer += count;
+    size   -= (size_t)count;
+  }
+
+  return 0;
+}
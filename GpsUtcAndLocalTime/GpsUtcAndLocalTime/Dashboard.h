@@ -0,0 +1,77 @@
+/**
+  ******************************************************************************
+  * @file    Dashboard.h
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Header file for Dashboard.c module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+#ifndef __DASHBOARD_H
+#define __DASHBOARD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Header includes -----------------------------------------------------------*/
+#include <stddef.h>
+
+/* Macro definitions ---------------------------------------------------------*/
+#ifndef DASHBOARD_MAX_ROW
+#define DASHBOARD_MAX_ROW    (48)
+#endif
+
+#ifndef DASHBOARD_MAX_COLUMN
+#define DASHBOARD_MAX_COLUMN (96)
+#endif
+
+/* Worst case frame: every row split into runs of one character and a cursor move. */
+#define DASHBOARD_OUTPUT_SIZE (DASHBOARD_MAX_ROW * (DASHBOARD_MAX_COLUMN * 3 + 16) + 32)
+
+/* Type definitions ----------------------------------------------------------*/
+typedef struct
+{
+  char   current[DASHBOARD_MAX_ROW][DASHBOARD_MAX_COLUMN];  /*!< Frame being built. */
+  char   previous[DASHBOARD_MAX_ROW][DASHBOARD_MAX_COLUMN]; /*!< Frame on the screen. */
+  char   output[DASHBOARD_OUTPUT_SIZE];
+  int    row;                                               /*!< Rows in use. */
+  int    column;                                            /*!< Widest row so far. */
+  int    drawn;                                             /*!< Nonzero once the screen is cleared. */
+  size_t bytes;                                             /*!< Bytes written by the last frame. */
+  double renderTime;                                        /*!< Seconds spent by the last frame. */
+}Dashboard;
+
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+void DashboardInit(Dashboard *dashboard);
+void DashboardPrint(Dashboard *dashboard, int row, const char *format, ...);
+int DashboardRender(Dashboard *dashboard);
+
+/* Function definitions ------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DASHBOARD_H */
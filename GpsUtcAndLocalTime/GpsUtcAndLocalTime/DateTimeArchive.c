@@ -0,0 +1,770 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeArchive.c
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Delta encoded columnar file format for epoch series.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+/* Header includes -----------------------------------------------------------*/
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "DateTimeArchive.h"
+#include "DateTimeCommon.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* Macro definitions ---------------------------------------------------------*/
+#define ARCHIVE_VERSION      (1)
+#define ARCHIVE_HEADER_SIZE  (32)
+#define ARCHIVE_INDEX_SIZE   (16)  /*!< Bytes per block in the index. */
+#define ARCHIVE_VARINT_SIZE  (10)  /*!< Longest 64-bit varint. */
+
+/* Type definitions ----------------------------------------------------------*/
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+static const unsigned char archiveMagic[4] = {'D', 'T', 'A', 'R'};
+
+/* Function declarations -----------------------------------------------------*/
+static void AppendEpoch(DateTimeArchiveWriter *writer, long long second);
+static void FlushRun(DateTimeArchiveWriter *writer);
+static void FlushBlock(DateTimeArchiveWriter *writer);
+static size_t DecodeBlock(const DateTimeArchiveReader *reader, unsigned int block, size_t skip, size_t count,
+                          GpsWeekSecond *time, double *mjd);
+static size_t PutVarint(unsigned char *buffer, unsigned long long value);
+static unsigned long long GetVarint(const unsigned char **buffer, const unsigned char *end);
+static void Put32(unsigned char *buffer, unsigned int value);
+static void Put64(unsigned char *buffer, unsigned long long value);
+static unsigned int Get32(const unsigned char *buffer);
+static unsigned long long Get64(const unsigned char *buffer);
+static unsigned long long ZigZag(long long value);
+static long long UnZigZag(unsigned long long value);
+
+/* Function definitions ------------------------------------------------------*/
+
+/**
+  * @brief  Create an archive for writing.
+  * @param  [out] writer:    Archive writer.
+  * @param  [in]  path:      File path.
+  * @param  [in]  blockSize: Epochs per block, 0 for DATETIME_ARCHIVE_BLOCK_SIZE.
+  * @return 0 on success, -1 on failure.
+  */
+int DateTimeArchiveWriterOpen(DateTimeArchiveWriter *writer, const char *path, unsigned int blockSize)
+{
+  unsigned char header[ARCHIVE_HEADER_SIZE] = {0};
+
+  memset(writer, 0, sizeof(*writer));
+
+  writer->blockSize = (blockSize == 0) ? DATETIME_ARCHIVE_BLOCK_SIZE : blockSize;
+  writer->offset    = ARCHIVE_HEADER_SIZE;
+
+  /* A record writes at most a run token and a delta of delta token. */
+  writer->buffer = (unsigned char *)malloc((size_t)writer->blockSize * 2 * ARCHIVE_VARINT_SIZE + ARCHIVE_VARINT_SIZE);
+
+  if(writer->buffer == NULL)
+  {
+    return -1;
+  }
+
+#if defined(_MSC_VER)
+  if(fopen_s(&writer->file, path, "wb") != 0)
+  {
+    writer->file = NULL;
+  }
+#else
+  writer->file = fopen(path, "wb");
+#endif
+
+  if((writer->file == NULL) || (fwrite(header, 1, sizeof(header), writer->file) != sizeof(header)))
+  {
+    if(writer->file != NULL)
+    {
+      fclose(writer->file);
+    }
+
+    free(writer->buffer);
+    writer->buffer = NULL;
+
+    return -1;
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Append packed epochs to the archive.
+  * @param  [in,out] writer: Archive writer.
+  * @param  [in]     second: Seconds since the gps epoch.
+  * @param  [in]     size:   The number of epochs.
+  * @return 0 on success, -1 on failure.
+  */
+int DateTimeArchiveWriteGpsSecond(DateTimeArchiveWriter *writer, const long long *second, size_t size)
+{
+  for(size_t i = 0; i < size; i++)
+  {
+    AppendEpoch(writer, second[i]);
+  }
+
+  return ((writer->buffer == NULL) || ferror(writer->file)) ? -1 : 0;
+}
+
+/**
+  * @brief  Append gps week and second epochs to the archive.
+  * @param  [in,out] writer: Archive writer.
+  * @param  [in]     time:   Gps week and second.
+  * @param  [in]     size:   The number of epochs.
+  * @return 0 on success, -1 on failure.
+  */
+int DateTimeArchiveWriteGpsWeekSecond(DateTimeArchiveWriter *writer, const GpsWeekSecond *time, size_t size)
+{
+  for(size_t i = 0; i < size; i++)
+  {
+    AppendEpoch(writer, GpsWeekSecondToGpsSecond(time[i]));
+  }
+
+  return ((writer->buffer == NULL) || ferror(writer->file)) ? -1 : 0;
+}
+
+/**
+  * @brief  Write the last block, the index and the header, then close the archive.
+  * @param  [in,out] writer: Archive writer.
+  * @return 0 on success, -1 on failure.
+  */
+int DateTimeArchiveWriterClose(DateTimeArchiveWriter *writer)
+{
+  int ret = (writer->buffer == NULL) ? -1 : 0;
+
+  if(writer->fill > 0)
+  {
+    FlushBlock(writer);
+  }
+
+  for(unsigned int i = 0; i < writer->blockCount; i++)
+  {
+    unsigned char entry[ARCHIVE_INDEX_SIZE];
+
+    Put64(entry, (unsigned long long)writer->index[2 * i]);
+    Put64(entry + 8, (unsigned long long)writer->index[2 * i + 1]);
+    fwrite(entry, 1, sizeof(entry), writer->file);
+  }
+
+  unsigned char header[ARCHIVE_HEADER_SIZE] = {0};
+
+  memcpy(header, archiveMagic, sizeof(archiveMagic));
+  Put32(header + 4, ARCHIVE_VERSION);
+  Put32(header + 8, writer->blockSize);
+  Put32(header + 12, writer->blockCount);
+  Put64(header + 16, writer->count);
+  Put64(header + 24, writer->offset);
+
+  if((fseek(writer->file, 0, SEEK_SET) != 0) ||
+     (fwrite(header, 1, sizeof(header), writer->file) != sizeof(header)) ||
+     ferror(writer->file))
+  {
+    ret = -1;
+  }
+
+  if(fclose(writer->file) != 0)
+  {
+    ret = -1;
+  }
+
+  free(writer->buffer);
+  free(writer->index);
+  memset(writer, 0, sizeof(*writer));
+
+  return ret;
+}
+
+/**
+  * @brief  Map an archive into memory for reading.
+  * @param  [out] reader: Archive reader.
+  * @param  [in]  path:   File path.
+  * @return 0 on success, -1 on failure or if the file is not a valid archive.
+  */
+int DateTimeArchiveReaderOpen(DateTimeArchiveReader *reader, const char *path)
+{
+  memset(reader, 0, sizeof(*reader));
+
+#if defined(_WIN32)
+  LARGE_INTEGER size = {0};
+
+  reader->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+  if(reader->file == INVALID_HANDLE_VALUE)
+  {
+    return -1;
+  }
+
+  if(GetFileSizeEx(reader->file, &size) && (size.QuadPart >= ARCHIVE_HEADER_SIZE))
+  {
+    reader->mapping = CreateFileMappingA(reader->file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    if(reader->mapping != NULL)
+    {
+      reader->data = (const unsigned char *)MapViewOfFile(reader->mapping, FILE_MAP_READ, 0, 0, 0);
+      reader->size = (size_t)size.QuadPart;
+    }
+  }
+#else
+  struct stat status;
+
+  reader->file = open(path, O_RDONLY);
+
+  if(reader->file < 0)
+  {
+    return -1;
+  }
+
+  if((fstat(reader->file, &status) == 0) && (status.st_size >= ARCHIVE_HEADER_SIZE))
+  {
+    void *data = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, reader->file, 0);
+
+    if(data != MAP_FAILED)
+    {
+      reader->data = (const unsigned char *)data;
+      reader->size = (size_t)status.st_size;
+    }
+  }
+#endif
+
+  if(reader->data == NULL)
+  {
+#if !defined(_WIN32)
+    close(reader->file);
+#endif
+    DateTimeArchiveReaderClose(reader);
+    return -1;
+  }
+
+  unsigned long long indexOffset = Get64(reader->data + 24);
+
+  reader->blockSize  = Get32(reader->data + 8);
+  reader->blockCount = Get32(reader->data + 12);
+  reader->count      = Get64(reader->data + 16);
+
+  if((memcmp(reader->data, archiveMagic, sizeof(archiveMagic)) != 0) ||
+     (Get32(reader->data + 4) != ARCHIVE_VERSION) || (reader->blockSize == 0) ||
+     (indexOffset > reader->size) ||
+     (((reader->size - indexOffset) / ARCHIVE_INDEX_SIZE) < reader->blockCount) ||
+     (reader->count > (unsigned long long)reader->blockCount * reader->blockSize))
+  {
+    DateTimeArchiveReaderClose(reader);
+    return -1;
+  }
+
+  reader->index = reader->data + indexOffset;
+
+  return 0;
+}
+
+/**
+  * @brief  Unmap and close an archive.
+  * @param  [in,out] reader: Archive reader.
+  * @return None.
+  * @note   Safe on a zero-initialized reader and after a failed open.
+  */
+void DateTimeArchiveReaderClose(DateTimeArchiveReader *reader)
+{
+#if defined(_WIN32)
+  if(reader->data != NULL)
+  {
+    UnmapViewOfFile(reader->data);
+  }
+
+  if(reader->mapping != NULL)
+  {
+    CloseHandle(reader->mapping);
+  }
+
+  if((reader->file != NULL) && (reader->file != INVALID_HANDLE_VALUE))
+  {
+    CloseHandle(reader->file);
+  }
+#else
+  /* Only a successful open maps the file, so a zeroed reader leaves fd 0 alone. */
+  if(reader->data != NULL)
+  {
+    munmap((void *)reader->data, reader->size);
+    close(reader->file);
+  }
+#endif
+
+  memset(reader, 0, sizeof(*reader));
+}
+
+/**
+  * @brief  Find the block holding an epoch.
+  * @param  [in] reader: Archive reader.
+  * @param  [in] second: Seconds since the gps epoch.
+  * @return The last block starting at or before the epoch, 0 if none does.
+  * @note   Only meaningful when the epochs were written in ascending order.
+  */
+unsigned int DateTimeArchiveFindBlock(const DateTimeArchiveReader *reader, long long second)
+{
+  unsigned int low  = 0;
+  unsigned int high = reader->blockCount;
+
+  while(high - low > 1)
+  {
+    unsigned int middle = low + (high - low) / 2;
+
+    if((long long)Get64(reader->index + (size_t)middle * ARCHIVE_INDEX_SIZE + 8) <= second)
+    {
+      low = middle;
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+
+  return low;
+}
+
+/**
+  * @brief  Decode a whole block into gps week and second.
+  * @param  [in]  reader: Archive reader.
+  * @param  [in]  block:  Block number.
+  * @param  [out] time:   Gps week and second, room for the block size.
+  * @return The number of epochs decoded.
+  */
+size_t DateTimeArchiveDecodeBlock(const DateTimeArchiveReader *reader, unsigned int block, GpsWeekSecond *time)
+{
+  return DecodeBlock(reader, block, 0, reader->blockSize, time, NULL);
+}
+
+/**
+  * @brief  Decode a whole block into modified julian date.
+  * @param  [in]  reader: Archive reader.
+  * @param  [in]  block:  Block number.
+  * @param  [out] mjd:    Modified julian date, room for the block size.
+  * @return The number of epochs decoded.
+  */
+size_t DateTimeArchiveDecodeBlockModifiedJulianDate(const DateTimeArchiveReader *reader, unsigned int block, double *mjd)
+{
+  return DecodeBlock(reader, block, 0, reader->blockSize, NULL, mjd);
+}
+
+/**
+  * @brief  Read a range of epochs as gps week and second.
+  * @param  [in]  reader: Archive reader.
+  * @param  [in]  first:  Index of the first epoch.
+  * @param  [in]  count:  The number of epochs.
+  * @param  [out] time:   Gps week and second.
+  * @return The number of epochs read.
+  */
+size_t DateTimeArchiveReadGpsWeekSecond(const DateTimeArchiveReader *reader, unsigned long long first,
+                                        size_t count, GpsWeekSecond *time)
+{
+  size_t total = 0;
+
+  while(total < count)
+  {
+    unsigned long long position = first + total;
+    size_t             size     = DecodeBlock(reader, (unsigned int)(position / reader->blockSize),
+                                              (size_t)(position % reader->blockSize), count - total,
+                                              time + total, NULL);
+
+    if(size == 0)
+    {
+      break;
+    }
+
+    total += size;
+  }
+
+  return total;
+}
+
+/**
+  * @brief  Read a range of epochs as modified julian date.
+  * @param  [in]  reader: Archive reader.
+  * @param  [in]  first:  Index of the first epoch.
+  * @param  [in]  count:  The number of epochs.
+  * @param  [out] mjd:    Modified julian date.
+  * @return The number of epochs read.
+  */
+size_t DateTimeArchiveReadModifiedJulianDate(const DateTimeArchiveReader *reader, unsigned long long first,
+                                             size_t count, double *mjd)
+{
+  size_t total = 0;
+
+  while(total < count)
+  {
+    unsigned long long position = first + total;
+    size_t             size     = DecodeBlock(reader, (unsigned int)(position / reader->blockSize),
+                                              (size_t)(position % reader->blockSize), count - total,
+                                              NULL, mjd + total);
+
+    if(size == 0)
+    {
+      break;
+    }
+
+    total += size;
+  }
+
+  return total;
+}
+
+/**
+  * @brief  Encode one epoch into the current block.
+  * @param  [in,out] writer: Archive writer.
+  * @param  [in]     second: Seconds since the gps epoch.
+  * @return None.
+  */
+static void AppendEpoch(DateTimeArchiveWriter *writer, long long second)
+{
+  if(writer->buffer == NULL)
+  {
+    return;
+  }
+
+  if(writer->fill == 0)
+  {
+    if(writer->blockCount == writer->indexCapacity)
+    {
+      unsigned int capacity = (writer->indexCapacity == 0) ? 64 : (writer->indexCapacity * 2);
+      long long   *index    = (long long *)realloc(writer->index, (size_t)capacity * 2 * sizeof(long long));
+
+      if(index == NULL)
+      {
+        free(writer->buffer);
+        writer->buffer = NULL;
+        return;
+      }
+
+      writer->index         = index;
+      writer->indexCapacity = capacity;
+    }
+
+    writer->index[2 * writer->blockCount]     = (long long)writer->offset;
+    writer->index[2 * writer->blockCount + 1] = second;
+    writer->blockCount++;
+
+    writer->used = PutVarint(writer->buffer, ZigZag(second));
+    writer->step = 0;
+    writer->run  = 0;
+  }
+  else
+  {
+    long long step = second - writer->last;
+
+    if(step == writer->step)
+    {
+      writer->run++;
+    }
+    else
+    {
+      FlushRun(writer);
+      writer->used += PutVarint(writer->buffer + writer->used, ZigZag(step - writer->step) << 1);
+      writer->step  = step;
+    }
+  }
+
+  writer->last = second;
+  writer->fill++;
+  writer->count++;
+
+  if(writer->fill == writer->blockSize)
+  {
+    FlushBlock(writer);
+  }
+}
+
+/**
+  * @brief  Write the pending run of unchanged steps.
+  * @param  [in,out] writer: Archive writer.
+  * @return None.
+  */
+static void FlushRun(DateTimeArchiveWriter *writer)
+{
+  if(writer->run > 0)
+  {
+    writer->used += PutVarint(writer->buffer + writer->used, (writer->run << 1) | 1);
+    writer->run   = 0;
+  }
+}
+
+/**
+  * @brief  Write the current block to the file.
+  * @param  [in,out] writer: Archive writer.
+  * @return None.
+  */
+static void FlushBlock(DateTimeArchiveWriter *writer)
+{
+  FlushRun(writer);
+
+  fwrite(writer->buffer, 1, writer->used, writer->file);
+
+  writer->offset += writer->used;
+  writer->used    = 0;
+  writer->fill    = 0;
+}
+
+/**
+  * @brief  Decode part of a block.
+  * @param  [in]  reader: Archive reader.
+  * @param  [in]  block:  Block number.
+  * @param  [in]  skip:   Epochs to skip at the start of the block.
+  * @param  [in]  count:  Largest number of epochs to decode.
+  * @param  [out] time:   Gps week and second output, or NULL.
+  * @param  [out] mjd:    Modified julian date output, or NULL.
+  * @return The number of epochs decoded.
+  */
+static size_t DecodeBlock(const DateTimeArchiveReader *reader, unsigned int block, size_t skip, size_t count,
+                          GpsWeekSecond *time, double *mjd)
+{
+  if(block >= reader->blockCount)
+  {
+    return 0;
+  }
+
+  unsigned long long first = (unsigned long long)block * reader->blockSize;
+  unsigned long long size  = reader->count - first;
+
+  if(size > reader->blockSize)
+  {
+    size = reader->blockSize;
+  }
+
+  if(skip >= size)
+  {
+    return 0;
+  }
+
+  if(count > (size - skip))
+  {
+    count = (size_t)(size - skip);
+  }
+
+  const unsigned char *entry  = reader->index + (size_t)block * ARCHIVE_INDEX_SIZE;
+  unsigned long long   offset = Get64(entry);
+  unsigned long long   end    = (block + 1 < reader->blockCount) ? Get64(entry + ARCHIVE_INDEX_SIZE)
+                                                                 : (unsigned long long)(reader->index - reader->data);
+
+  if((offset >= end) || (end > reader->size))
+  {
+    return 0;
+  }
+
+  const unsigned char *buffer = reader->data + offset;
+  const unsigned char *limit  = reader->data + end;
+  long long            second = UnZigZag(GetVarint(&buffer, limit));
+  long long            step   = 0;
+  unsigned long long   run    = 0;
+  size_t               stop   = skip + count;
+  size_t               output = 0;
+
+  for(size_t i = 0; i < stop; i++)
+  {
+    if(i > 0)
+    {
+      if(run == 0)
+      {
+        if(buffer >= limit)
+        {
+          break;
+        }
+
+        unsigned long long token = GetVarint(&buffer, limit);
+
+        if(token & 1)
+        {
+          run = token >> 1;
+        }
+        else
+        {
+          step += UnZigZag(token >> 1);
+        }
+      }
+
+      if(run > 0)
+      {
+        run--;
+      }
+
+      second += step;
+    }
+
+    if(i >= skip)
+    {
+      if(time != NULL)
+      {
+        time[output] = GpsSecondToGpsWeekSecond(second);
+      }
+      else
+      {
+        mjd[output] = GPS_EPOCH_MJD + second / 86400.0;
+      }
+
+      output++;
+    }
+  }
+
+  return output;
+}
+
+/**
+  * @brief  Write an unsigned varint.
+  * @param  [out] buffer: Output, room for ARCHIVE_VARINT_SIZE bytes.
+  * @param  [in]  value:  Value.
+  * @return The number of bytes written.
+  */
+static size_t PutVarint(unsigned char *buffer, unsigned long long value)
+{
+  size_t size = 0;
+
+  while(value >= 0x80)
+  {
+    buffer[size++] = (unsigned char)(value | 0x80);
+    value        >>= 7;
+  }
+
+  buffer[size++] = (unsigned char)value;
+
+  return size;
+}
+
+/**
+  * @brief  Read an unsigned varint.
+  * @param  [in,out] buffer: Input position, advanced past the varint.
+  * @param  [in]     end:    End of the input.
+  * @return Value, 0 if the input ends first.
+  */
+static unsigned long long GetVarint(const unsigned char **buffer, const unsigned char *end)
+{
+  const unsigned char *p     = *buffer;
+  unsigned long long   value = 0;
+
+  for(int shift = 0; (p < end) && (shift < 64); shift += 7)
+  {
+    unsigned char byte = *p++;
+
+    value |= (unsigned long long)(byte & 0x7F) << shift;
+
+    if((byte & 0x80) == 0)
+    {
+      *buffer = p;
+      return value;
+    }
+  }
+
+  *buffer = end;
+
+  return 0;
+}
+
+/**
+  * @brief  Write a 32-bit little endian integer.
+  * @param  [out] buffer: Output.
+  * @param  [in]  value:  Value.
+  * @return None.
+  */
+static void Put32(unsigned char *buffer, unsigned int value)
+{
+  for(int i = 0; i < 4; i++)
+  {
+    buffer[i] = (unsigned char)(value >> (8 * i));
+  }
+}
+
+/**
+  * @brief  Write a 64-bit little endian integer.
+  * @param  [out] buffer: Output.
+  * @param  [in]  value:  Value.
+  * @return None.
+  */
+static void Put64(unsigned char *buffer, unsigned long long value)
+{
+  for(int i = 0; i < 8; i++)
+  {
+    buffer[i] = (unsigned char)(value >> (8 * i));
+  }
+}
+
+/**
+  * @brief  Read a 32-bit little endian integer.
+  * @param  [in] buffer: Input.
+  * @return Value.
+  */
+static unsigned int Get32(const unsigned char *buffer)
+{
+  unsigned int value = 0;
+
+  for(int i = 3; i >= 0; i--)
+  {
+    value = (value << 8) | buffer[i];
+  }
+
+  return value;
+}
+
+/**
+  * @brief  Read a 64-bit little endian integer.
+  * @param  [in] buffer: Input.
+  * @return Value.
+  */
+static unsigned long long Get64(const unsigned char *buffer)
+{
+  unsigned long long value = 0;
+
+  for(int i = 7; i >= 0; i--)
+  {
+    value = (value << 8) | buffer[i];
+  }
+
+  return value;
+}
+
+/**
+  * @brief  Map a signed value to unsigned so small magnitudes stay small.
+  * @param  [in] value: Signed value.
+  * @return Zigzag encoded value.
+  */
+static unsigned long long ZigZag(long long value)
+{
+  return ((unsigned long long)value << 1) ^ (unsigned long long)(value >> 63);
+}
+
+/**
+  * @brief  Undo ZigZag().
+  * @param  [in] value: Zigzag encoded value.
+  * @return Signed value.
+  */
+static long long UnZigZag(unsigned long long value)
+{
+  return (long long)(value >> 1) ^ -(long long)(value & 1);
+}
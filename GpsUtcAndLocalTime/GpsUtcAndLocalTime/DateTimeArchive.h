@@ -0,0 +1,112 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeArchive.h
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Header file for DateTimeArchive.c module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+#ifndef __DATETIMEARCHIVE_H
+#define __DATETIMEARCHIVE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Header includes -----------------------------------------------------------*/
+#include "DateTime.h"
+#include <stddef.h>
+#include <stdio.h>
+
+/* Macro definitions ---------------------------------------------------------*/
+#define DATETIME_ARCHIVE_BLOCK_SIZE  (4096) /*!< Default epochs per block. */
+
+/* Type definitions ----------------------------------------------------------*/
+
+/*
+ * File layout, all integers little endian:
+ *   header  "DTAR", version, epochs per block, block count, epoch count, index offset
+ *   blocks  first epoch as a zigzag varint, then one varint token per change
+ *           of step: a zigzag delta of delta shifted left by one, or a run
+ *           of unchanged steps shifted left by one with the low bit set
+ *   index   file offset and first epoch of every block
+ * Epochs are packed as seconds since the gps epoch.
+ */
+typedef struct
+{
+  FILE               *file;
+  unsigned int        blockSize;
+  unsigned int        blockCount;
+  unsigned int        indexCapacity;
+  unsigned long long  count;
+  unsigned long long  offset;     /*!< File offset of the block being built. */
+  long long          *index;      /*!< Offset and first epoch of each block. */
+  unsigned char      *buffer;     /*!< Block being built. */
+  size_t              used;
+  unsigned int        fill;       /*!< Epochs in the block being built. */
+  long long           last;
+  long long           step;
+  unsigned long long  run;        /*!< Unchanged steps not yet written. */
+}DateTimeArchiveWriter;
+
+typedef struct
+{
+  const unsigned char *data;
+  size_t               size;
+  unsigned int         blockSize;
+  unsigned int         blockCount;
+  unsigned long long   count;
+  const unsigned char *index;
+#if defined(_WIN32)
+  void                *file;
+  void                *mapping;
+#else
+  int                  file;
+#endif
+}DateTimeArchiveReader;
+
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+int DateTimeArchiveWriterOpen(DateTimeArchiveWriter *writer, const char *path, unsigned int blockSize);
+int DateTimeArchiveWriteGpsSecond(DateTimeArchiveWriter *writer, const long long *second, size_t size);
+int DateTimeArchiveWriteGpsWeekSecond(DateTimeArchiveWriter *writer, const GpsWeekSecond *time, size_t size);
+int DateTimeArchiveWriterClose(DateTimeArchiveWriter *writer);
+
+int DateTimeArchiveReaderOpen(DateTimeArchiveReader *reader, const char *path);
+void DateTimeArchiveReaderClose(DateTimeArchiveReader *reader);
+unsigned int DateTimeArchiveFindBlock(const DateTimeArchiveReader *reader, long long second);
+size_t DateTimeArchiveDecodeBlock(const DateTimeArchiveReader *reader, unsigned int block, GpsWeekSecond *time);
+size_t DateTimeArchiveDecodeBlockModifiedJulianDate(const DateTimeArchiveReader *reader, unsigned int block, double *mjd);
+size_t DateTimeArchiveReadGpsWeekSecond(const DateTimeArchiveReader *reader, unsigned long long first,
+                                        size_t count, GpsWeekSecond *time);
+size_t DateTimeArchiveReadModifiedJulianDate(const DateTimeArchiveReader *reader, unsigned long long first,
+                                             size_t count, double *mjd);
+
+/* Function definitions ------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DATETIMEARCHIVE_H */
@@ -0,0 +1,397 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeBucket.c
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Group epochs into hour, day, month or gps week buckets.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+/* Header includes -----------------------------------------------------------*/
+#include "DateTimeBucket.h"
+#include "DateTimeCommon.h"
+#include <math.h>
+
+/* Macro definitions ---------------------------------------------------------*/
+/*
+ * A double modified julian date near 60000 resolves about 1 us, so it is
+ * rounded to the nearest microsecond before flooring to whole seconds.
+ */
+#define MJD_MICROSECOND  (1000000.0)
+
+/* Type definitions ----------------------------------------------------------*/
+
+/* The bucket found last, [start, next) in offset seconds since the gps epoch. */
+typedef struct
+{
+  long long start;
+  long long next;
+  int       bucket;
+}BucketCursor;
+
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+static void BucketLocate(BucketCursor *cursor, long long second, DateTimeBucketUnit unit);
+static long long BucketBegin(int bucket, DateTimeBucketUnit unit);
+static long long MonthBegin(int year, int month);
+static long long ModifiedJulianDateToGpsSecond(double mjd);
+static void GroupByAppend(const BucketCursor *cursor, size_t i, int *bucket, size_t *first, size_t *count, size_t *size);
+
+/* Function definitions ------------------------------------------------------*/
+
+/**
+  * @brief  Bucket of a packed epoch.
+  * @param  [in] second: Seconds since the gps epoch.
+  * @param  [in] unit:   Bucket unit.
+  * @param  [in] offset: Seconds added before bucketing.
+  * @return Bucket number.
+  */
+int GpsSecondBucket(long long second, DateTimeBucketUnit unit, int offset)
+{
+  BucketCursor cursor = {0};
+
+  BucketLocate(&cursor, second + offset, unit);
+
+  return cursor.bucket;
+}
+
+/**
+  * @brief  Start of a bucket as a packed epoch.
+  * @param  [in] bucket: Bucket number.
+  * @param  [in] unit:   Bucket unit.
+  * @param  [in] offset: Seconds added before bucketing.
+  * @return Seconds since the gps epoch.
+  */
+long long GpsSecondBucketStart(int bucket, DateTimeBucketUnit unit, int offset)
+{
+  return BucketBegin(bucket, unit) - offset;
+}
+
+/**
+  * @brief  Bucket of every packed epoch in an array.
+  * @param  [in]  second: Seconds since the gps epoch.
+  * @param  [in]  size:   The number of epochs.
+  * @param  [in]  unit:   Bucket unit.
+  * @param  [in]  offset: Seconds added before bucketing.
+  * @param  [out] bucket: Bucket number of each epoch.
+  * @param  [out] start:  Start of the bucket of each epoch, may be NULL.
+  * @return None.
+  * @note   The input need not be sorted, but sorted input only compares
+  *         against the next boundary until it is crossed.
+  */
+void GpsSecondToBucket(const long long *second, size_t size, DateTimeBucketUnit unit, int offset,
+                       int *bucket, long long *start)
+{
+  BucketCursor cursor = {.start = 1, .next = 0, .bucket = 0};
+
+  for(size_t i = 0; i < size; i++)
+  {
+    long long value = second[i] + offset;
+
+    if((value < cursor.start) || (value >= cursor.next))
+    {
+      BucketLocate(&cursor, value, unit);
+    }
+
+    bucket[i] = cursor.bucket;
+
+    if(start != NULL)
+    {
+      start[i] = cursor.start - offset;
+    }
+  }
+}
+
+/**
+  * @brief  Bucket of every gps week and second in an array.
+  * @param  [in]  time:   Gps week and second.
+  * @param  [in]  size:   The number of epochs.
+  * @param  [in]  unit:   Bucket unit.
+  * @param  [in]  offset: Seconds added before bucketing.
+  * @param  [out] bucket: Bucket number of each epoch.
+  * @param  [out] start:  Start of the bucket of each epoch, may be NULL.
+  * @return None.
+  */
+void GpsWeekSecondToBucket(const GpsWeekSecond *time, size_t size, DateTimeBucketUnit unit, int offset,
+                           int *bucket, GpsWeekSecond *start)
+{
+  BucketCursor cursor = {.start = 1, .next = 0, .bucket = 0};
+
+  for(size_t i = 0; i < size; i++)
+  {
+    long long value = GpsWeekSecondToGpsSecond(time[i]) + offset;
+
+    if((value < cursor.start) || (value >= cursor.next))
+    {
+      BucketLocate(&cursor, value, unit);
+    }
+
+    bucket[i] = cursor.bucket;
+
+    if(start != NULL)
+    {
+      start[i] = GpsSecondToGpsWeekSecond(cursor.start - offset);
+    }
+  }
+}
+
+/**
+  * @brief  Bucket of every modified julian date in an array.
+  * @param  [in]  mjd:    Modified julian date.
+  * @param  [in]  size:   The number of epochs.
+  * @param  [in]  unit:   Bucket unit.
+  * @param  [in]  offset: Seconds added before bucketing.
+  * @param  [out] bucket: Bucket number of each epoch.
+  * @param  [out] start:  Start of the bucket of each epoch, may be NULL.
+  * @return None.
+  */
+void ModifiedJulianDateToBucket(const double *mjd, size_t size, DateTimeBucketUnit unit, int offset,
+                                int *bucket, double *start)
+{
+  BucketCursor cursor = {.start = 1, .next = 0, .bucket = 0};
+
+  for(size_t i = 0; i < size; i++)
+  {
+    long long value = ModifiedJulianDateToGpsSecond(mjd[i]) + offset;
+
+    if((value < cursor.start) || (value >= cursor.next))
+    {
+      BucketLocate(&cursor, value, unit);
+    }
+
+    bucket[i] = cursor.bucket;
+
+    if(start != NULL)
+    {
+      start[i] = GPS_EPOCH_MJD + (cursor.start - offset) / 86400.0;
+    }
+  }
+}
+
+/**
+  * @brief  Group sorted packed epochs by bucket.
+  * @param  [in]  second: Seconds since the gps epoch, sorted in ascending order.
+  * @param  [in]  size:   The number of epochs.
+  * @param  [in]  unit:   Bucket unit.
+  * @param  [in]  offset: Seconds added before bucketing.
+  * @param  [out] bucket: Bucket number of each group.
+  * @param  [out] first:  Index of the first epoch of each group.
+  * @param  [out] count:  The number of epochs in each group.
+  * @return The number of groups, at most size.
+  */
+size_t GpsSecondGroupBy(const long long *second, size_t size, DateTimeBucketUnit unit, int offset,
+                        int *bucket, size_t *first, size_t *count)
+{
+  BucketCursor cursor = {.start = 1, .next = 0, .bucket = 0};
+  size_t       group  = 0;
+
+  for(size_t i = 0; i < size; i++)
+  {
+    long long value = second[i] + offset;
+
+    if((value < cursor.start) || (value >= cursor.next))
+    {
+      BucketLocate(&cursor, value, unit);
+    }
+
+    GroupByAppend(&cursor, i, bucket, first, count, &group);
+  }
+
+  return group;
+}
+
+/**
+  * @brief  Group sorted gps week and second by bucket.
+  * @param  [in]  time:   Gps week and second, sorted in ascending order.
+  * @param  [in]  size:   The number of epochs.
+  * @param  [in]  unit:   Bucket unit.
+  * @param  [in]  offset: Seconds added before bucketing.
+  * @param  [out] bucket: Bucket number of each group.
+  * @param  [out] first:  Index of the first epoch of each group.
+  * @param  [out] count:  The number of epochs in each group.
+  * @return The number of groups, at most size.
+  */
+size_t GpsWeekSecondGroupBy(const GpsWeekSecond *time, size_t size, DateTimeBucketUnit unit, int offset,
+                            int *bucket, size_t *first, size_t *count)
+{
+  BucketCursor cursor = {.start = 1, .next = 0, .bucket = 0};
+  size_t       group  = 0;
+
+  for(size_t i = 0; i < size; i++)
+  {
+    long long value = GpsWeekSecondToGpsSecond(time[i]) + offset;
+
+    if((value < cursor.start) || (value >= cursor.next))
+    {
+      BucketLocate(&cursor, value, unit);
+    }
+
+    GroupByAppend(&cursor, i, bucket, first, count, &group);
+  }
+
+  return group;
+}
+
+/**
+  * @brief  Group sorted modified julian dates by bucket.
+  * @param  [in]  mjd:    Modified julian date, sorted in ascending order.
+  * @param  [in]  size:   The number of epochs.
+  * @param  [in]  unit:   Bucket unit.
+  * @param  [in]  offset: Seconds added before bucketing.
+  * @param  [out] bucket: Bucket number of each group.
+  * @param  [out] first:  Index of the first epoch of each group.
+  * @param  [out] count:  The number of epochs in each group.
+  * @return The number of groups, at most size.
+  */
+size_t ModifiedJulianDateGroupBy(const double *mjd, size_t size, DateTimeBucketUnit unit, int offset,
+                                 int *bucket, size_t *first, size_t *count)
+{
+  BucketCursor cursor = {.start = 1, .next = 0, .bucket = 0};
+  size_t       group  = 0;
+
+  for(size_t i = 0; i < size; i++)
+  {
+    long long value = ModifiedJulianDateToGpsSecond(mjd[i]) + offset;
+
+    if((value < cursor.start) || (value >= cursor.next))
+    {
+      BucketLocate(&cursor, value, unit);
+    }
+
+    GroupByAppend(&cursor, i, bucket, first, count, &group);
+  }
+
+  return group;
+}
+
+/**
+  * @brief  Find the bucket holding an epoch.
+  * @param  [out] cursor: Bucket found.
+  * @param  [in]  second: Offset seconds since the gps epoch.
+  * @param  [in]  unit:   Bucket unit.
+  * @return None.
+  */
+static void BucketLocate(BucketCursor *cursor, long long second, DateTimeBucketUnit unit)
+{
+  switch(unit)
+  {
+    case DATETIME_BUCKET_HOUR:
+      cursor->bucket = (int)FloorDivide(second, 3600);
+      break;
+
+    case DATETIME_BUCKET_DAY:
+      cursor->bucket = (int)FloorDivide(second, 86400);
+      break;
+
+    case DATETIME_BUCKET_MONTH:
+    {
+      DateTime date = JulianDateToGregorianCalendarDate(GPS_EPOCH_JD + FloorDivide(second, 86400));
+
+      cursor->bucket = (date.year - 1980) * 12 + date.month - 1;
+      break;
+    }
+
+    default:
+      cursor->bucket = (int)FloorDivide(second, 604800);
+      break;
+  }
+
+  cursor->start = BucketBegin(cursor->bucket, unit);
+  cursor->next  = BucketBegin(cursor->bucket + 1, unit);
+}
+
+/**
+  * @brief  Start of a bucket.
+  * @param  [in] bucket: Bucket number.
+  * @param  [in] unit:   Bucket unit.
+  * @return Offset seconds since the gps epoch.
+  */
+static long long BucketBegin(int bucket, DateTimeBucketUnit unit)
+{
+  switch(unit)
+  {
+    case DATETIME_BUCKET_HOUR:
+      return bucket * 3600LL;
+
+    case DATETIME_BUCKET_DAY:
+      return bucket * 86400LL;
+
+    case DATETIME_BUCKET_MONTH:
+    {
+      int year = 1980 + (int)FloorDivide(bucket, 12);
+
+      return MonthBegin(year, bucket - (year - 1980) * 12 + 1);
+    }
+
+    default:
+      return bucket * 604800LL;
+  }
+}
+
+/**
+  * @brief  Start of a month.
+  * @param  [in] year:  Year.
+  * @param  [in] month: Month, 1 to 12.
+  * @return Seconds since the gps epoch.
+  */
+static long long MonthBegin(int year, int month)
+{
+  DateTime date = {.year = year, .month = month, .day = 1, .hour = 0, .minute = 0, .second = 0};
+
+  return (long long)(GregorianCalendarDateToJulianDate(date) - GPS_EPOCH_JD) * 86400;
+}
+
+/**
+  * @brief  Modified julian date to packed epoch.
+  * @param  [in] mjd: Modified julian date.
+  * @return Seconds since the gps epoch, rounded down.
+  */
+static long long ModifiedJulianDateToGpsSecond(double mjd)
+{
+  long long microsecond = (long long)floor((mjd - GPS_EPOCH_MJD) * 86400.0 * MJD_MICROSECOND + 0.5);
+
+  return FloorDivide(microsecond, (long long)MJD_MICROSECOND);
+}
+
+/**
+  * @brief  Count an epoch into the current group, opening a new group if needed.
+  * @param  [in]     cursor: Bucket of the epoch.
+  * @param  [in]     i:      Index of the epoch.
+  * @param  [out]    bucket: Bucket number of each group.
+  * @param  [out]    first:  Index of the first epoch of each group.
+  * @param  [out]    count:  The number of epochs in each group.
+  * @param  [in,out] size:   The number of groups.
+  * @return None.
+  */
+static void GroupByAppend(const BucketCursor *cursor, size_t i, int *bucket, size_t *first, size_t *count, size_t *size)
+{
+  if((*size == 0) || (bucket[*size - 1] != cursor->bucket))
+  {
+    bucket[*size] = cursor->bucket;
+    first[*size]  = i;
+    count[*size]  = 0;
+    (*size)++;
+  }
+
+  count[*size - 1]++;
+}
@@ -0,0 +1,84 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeBucket.h
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Header file for DateTimeBucket.c module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+#ifndef __DATETIMEBUCKET_H
+#define __DATETIMEBUCKET_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Header includes -----------------------------------------------------------*/
+#include "DateTime.h"
+#include <stddef.h>
+
+/* Macro definitions ---------------------------------------------------------*/
+/* Type definitions ----------------------------------------------------------*/
+
+/*
+ * Bucket numbers count from the gps epoch 1980-01-06 00:00:00: hours, days
+ * or gps weeks since then, or months since 1980-01. Packed epochs are
+ * seconds since the gps epoch in a long long. The offset in seconds is
+ * added to every epoch before bucketing, -18 turns gps time into utc and
+ * 28800 then gives days of utc+8.
+ */
+typedef enum
+{
+  DATETIME_BUCKET_HOUR = 0,
+  DATETIME_BUCKET_DAY,
+  DATETIME_BUCKET_MONTH,
+  DATETIME_BUCKET_GPS_WEEK
+}DateTimeBucketUnit;
+
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+int GpsSecondBucket(long long second, DateTimeBucketUnit unit, int offset);
+long long GpsSecondBucketStart(int bucket, DateTimeBucketUnit unit, int offset);
+
+void GpsSecondToBucket(const long long *second, size_t size, DateTimeBucketUnit unit, int offset,
+                       int *bucket, long long *start);
+void GpsWeekSecondToBucket(const GpsWeekSecond *time, size_t size, DateTimeBucketUnit unit, int offset,
+                           int *bucket, GpsWeekSecond *start);
+void ModifiedJulianDateToBucket(const double *mjd, size_t size, DateTimeBucketUnit unit, int offset,
+                                int *bucket, double *start);
+
+size_t GpsSecondGroupBy(const long long *second, size_t size, DateTimeBucketUnit unit, int offset,
+                        int *bucket, size_t *first, size_t *count);
+size_t GpsWeekSecondGroupBy(const GpsWeekSecond *time, size_t size, DateTimeBucketUnit unit, int offset,
+                            int *bucket, size_t *first, size_t *count);
+size_t ModifiedJulianDateGroupBy(const double *mjd, size_t size, DateTimeBucketUnit unit, int offset,
+                                 int *bucket, size_t *first, size_t *count);
+
+/* Function definitions ------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DATETIMEBUCKET_H */
@@ -0,0 +1,360 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeCheck.c
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Validation and sanitizing of date and time input.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+/* Header includes -----------------------------------------------------------*/
+#include "DateTimeCheck.h"
+#include "DateTimeCommon.h"
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define DATETIME_CHECK_SSE2
+#include <emmintrin.h>
+#endif
+
+/* Macro definitions ---------------------------------------------------------*/
+/* Type definitions ----------------------------------------------------------*/
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+static const int monthDay[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+/* Function declarations -----------------------------------------------------*/
+static int DaysInMonth(int year, int month);
+static int Clamp(int value, int low, int high);
+static DateTime ClampDateTime(DateTime time);
+static DateTime NormalizeDateTime(DateTime time);
+
+/* Function definitions ------------------------------------------------------*/
+
+/**
+  * @brief  Check a gregorian calendar date.
+  * @param  [in] time: Gregorian calendar date.
+  * @return 1 if valid, 0 if not.
+  */
+int GregorianCalendarDateIsValid(DateTime time)
+{
+  if((time.year < DATETIME_CHECK_YEAR_MIN) || (time.year > DATETIME_CHECK_YEAR_MAX) ||
+     (time.month < 1) || (time.month > 12) ||
+     (time.day < 1) || (time.day > DaysInMonth(time.year, time.month)) ||
+     (time.hour < 0) || (time.hour > 23) ||
+     (time.minute < 0) || (time.minute > 59) ||
+     (time.second < 0) || (time.second > 60))
+  {
+    return 0;
+  }
+
+  if(time.second == 60)
+  {
+    return (time.hour == 23) && (time.minute == 59) &&
+           (((time.month == 6) && (time.day == 30)) || ((time.month == 12) && (time.day == 31)));
+  }
+
+  return 1;
+}
+
+/**
+  * @brief  Check a gps week and second.
+  * @param  [in] time: Gps week and second.
+  * @return 1 if valid, 0 if not.
+  */
+int GpsWeekSecondIsValid(GpsWeekSecond time)
+{
+  return (time.week >= 0) && (time.second >= 0) && (time.second < 604800);
+}
+
+/**
+  * @brief  Check an array of gregorian calendar dates.
+  * @param  [in]  time: Gregorian calendar dates.
+  * @param  [in]  size: The number of dates.
+  * @param  [out] mask: Bit i of word i / 64 is set if date i is invalid,
+  *                     (size + 63) / 64 words, may be NULL.
+  * @return The number of invalid dates.
+  * @note   With SSE2 four dates are checked at a time, including the length
+  *         of the month, only 29 February and second 60 go through the
+  *         scalar check.
+  */
+size_t GregorianCalendarDateCheck(const DateTime *time, size_t size, unsigned long long *mask)
+{
+  size_t count = 0;
+  size_t i     = 0;
+
+  if(mask != NULL)
+  {
+    memset(mask, 0, (size + 63) / 64 * sizeof(*mask));
+  }
+
+#if defined(DATETIME_CHECK_SSE2)
+  /*
+   * Four dates are six vectors and the fields repeat every three vectors.
+   * A lane is flagged when it is below its lower limit or above its upper
+   * limit, with second 59 as the upper limit. Days are then compared with
+   * the length of their month, 28 for February, so a leap day or a leap
+   * second is the only valid date that takes the scalar path.
+   */
+  const __m128i low0   = _mm_setr_epi32(DATETIME_CHECK_YEAR_MIN, 1, 1, 0);
+  const __m128i low1   = _mm_setr_epi32(0, 0, DATETIME_CHECK_YEAR_MIN, 1);
+  const __m128i low2   = _mm_setr_epi32(1, 0, 0, 0);
+  const __m128i high0  = _mm_setr_epi32(DATETIME_CHECK_YEAR_MAX, 12, 31, 23);
+  const __m128i high1  = _mm_setr_epi32(59, 59, DATETIME_CHECK_YEAR_MAX, 12);
+  const __m128i high2  = _mm_setr_epi32(31, 23, 59, 59);
+  const __m128i one    = _mm_set1_epi32(1);
+  const __m128i two    = _mm_set1_epi32(2);
+  const __m128i thirty = _mm_set1_epi32(30);
+
+  for(; i + 4 <= size; i += 4)
+  {
+    const __m128i *p = (const __m128i *)(time + i);
+    __m128i        v0 = _mm_loadu_si128(p + 0);
+    __m128i        v1 = _mm_loadu_si128(p + 1);
+    __m128i        v2 = _mm_loadu_si128(p + 2);
+    __m128i        v3 = _mm_loadu_si128(p + 3);
+    __m128i        v4 = _mm_loadu_si128(p + 4);
+    __m128i        v5 = _mm_loadu_si128(p + 5);
+    __m128i        f0 = _mm_or_si128(_mm_cmplt_epi32(v0, low0), _mm_cmpgt_epi32(v0, high0));
+    __m128i        f1 = _mm_or_si128(_mm_cmplt_epi32(v1, low1), _mm_cmpgt_epi32(v1, high1));
+    __m128i        f2 = _mm_or_si128(_mm_cmplt_epi32(v2, low2), _mm_cmpgt_epi32(v2, high2));
+    __m128i        f3 = _mm_or_si128(_mm_cmplt_epi32(v3, low0), _mm_cmpgt_epi32(v3, high0));
+    __m128i        f4 = _mm_or_si128(_mm_cmplt_epi32(v4, low1), _mm_cmpgt_epi32(v4, high1));
+    __m128i        f5 = _mm_or_si128(_mm_cmplt_epi32(v5, low2), _mm_cmpgt_epi32(v5, high2));
+    __m128i        f  = _mm_or_si128(_mm_or_si128(_mm_or_si128(f0, f1), _mm_or_si128(f2, f3)), _mm_or_si128(f4, f5));
+
+    /* Months and days of dates 0, 2, 1, 3; 31 days when month + month / 8 is odd. */
+    __m128i month = _mm_unpackhi_epi64(_mm_unpacklo_epi32(v0, v3), _mm_unpackhi_epi32(v1, v4));
+    __m128i day   = _mm_unpacklo_epi64(_mm_unpackhi_epi32(v0, v3), _mm_unpacklo_epi32(v2, v5));
+    __m128i last  = _mm_and_si128(_mm_add_epi32(month, _mm_srli_epi32(month, 3)), one);
+
+    last = _mm_sub_epi32(_mm_add_epi32(thirty, last), _mm_and_si128(_mm_cmpeq_epi32(month, two), two));
+    f    = _mm_or_si128(f, _mm_cmpgt_epi32(day, last));
+
+    if(_mm_movemask_epi8(f) == 0)
+    {
+      continue;
+    }
+
+    /* Rare: a bad field, a leap day or a second of 60 somewhere. */
+    for(size_t j = i; j < i + 4; j++)
+    {
+      if(!GregorianCalendarDateIsValid(time[j]))
+      {
+        if(mask != NULL)
+        {
+          mask[j / 64] |= 1ULL << (j % 64);
+        }
+
+        count++;
+      }
+    }
+  }
+#endif
+
+  for(; i < size; i++)
+  {
+    if(!GregorianCalendarDateIsValid(time[i]))
+    {
+      if(mask != NULL)
+      {
+        mask[i / 64] |= 1ULL << (i % 64);
+      }
+
+      count++;
+    }
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Make a gregorian calendar date valid.
+  * @param  [in] time: Gregorian calendar date.
+  * @param  [in] mode: Clamp or normalize.
+  * @return Valid gregorian calendar date, the input itself if it was valid.
+  * @note   Normalizing clamps whatever still falls outside the year limits.
+  */
+DateTime GregorianCalendarDateSanitize(DateTime time, DateTimeSanitize mode)
+{
+  if(GregorianCalendarDateIsValid(time))
+  {
+    return time;
+  }
+
+  if(mode == DATETIME_SANITIZE_NORMALIZE)
+  {
+    return NormalizeDateTime(time);
+  }
+
+  return ClampDateTime(time);
+}
+
+/**
+  * @brief  Make an array of gregorian calendar dates valid in place.
+  * @param  [in,out] time: Gregorian calendar dates.
+  * @param  [in]     size: The number of dates.
+  * @param  [in]     mode: Clamp or normalize.
+  * @return The number of dates changed.
+  */
+size_t GregorianCalendarDateSanitizeArray(DateTime *time, size_t size, DateTimeSanitize mode)
+{
+  size_t count = 0;
+
+  for(size_t i = 0; i < size; i += 64)
+  {
+    size_t             block = (size - i < 64) ? (size - i) : 64;
+    unsigned long long mask  = 0;
+
+    if(GregorianCalendarDateCheck(time + i, block, &mask) == 0)
+    {
+      continue;
+    }
+
+    for(size_t j = 0; j < block; j++)
+    {
+      if(mask & (1ULL << j))
+      {
+        time[i + j] = GregorianCalendarDateSanitize(time[i + j], mode);
+        count++;
+      }
+    }
+  }
+
+  return count;
+}
+
+/**
+  * @brief  The number of days in a month.
+  * @param  [in] year:  Year.
+  * @param  [in] month: Month, 1 to 12.
+  * @return The number of days.
+  */
+static int DaysInMonth(int year, int month)
+{
+  if((month == 2) && IsLeapYear(year))
+  {
+    return 29;
+  }
+
+  return monthDay[month - 1];
+}
+
+/**
+  * @brief  Limit a value to a range.
+  * @param  [in] value: Value.
+  * @param  [in] low:   Lower limit.
+  * @param  [in] high:  Upper limit.
+  * @return Limited value.
+  */
+static int Clamp(int value, int low, int high)
+{
+  if(value < low)
+  {
+    return low;
+  }
+
+  if(value > high)
+  {
+    return high;
+  }
+
+  return value;
+}
+
+/**
+  * @brief  Clamp every field of a gregorian calendar date into its range.
+  * @param  [in] time: Gregorian calendar date.
+  * @return Valid gregorian calendar date.
+  */
+static DateTime ClampDateTime(DateTime time)
+{
+  time.year   = Clamp(time.year, DATETIME_CHECK_YEAR_MIN, DATETIME_CHECK_YEAR_MAX);
+  time.month  = Clamp(time.month, 1, 12);
+  time.day    = Clamp(time.day, 1, DaysInMonth(time.year, time.month));
+  time.hour   = Clamp(time.hour, 0, 23);
+  time.minute = Clamp(time.minute, 0, 59);
+  time.second = Clamp(time.second, 0, 60);
+
+  if(!GregorianCalendarDateIsValid(time))
+  {
+    time.second = 59;
+  }
+
+  return time;
+}
+
+/**
+  * @brief  Carry overflowing fields of a gregorian calendar date.
+  * @param  [in] time: Gregorian calendar date.
+  * @return Valid gregorian calendar date.
+  */
+static DateTime NormalizeDateTime(DateTime time)
+{
+  long long second = time.hour * 3600LL + time.minute * 60LL + time.second;
+  long long month  = time.month - 1LL;
+  long long year   = time.year + FloorDivide(month, 12);
+
+  if((year < DATETIME_CHECK_YEAR_MIN) || (year > DATETIME_CHECK_YEAR_MAX))
+  {
+    return ClampDateTime(time);
+  }
+
+  DateTime first = {0};
+
+  first.year  = (int)year;
+  first.month = (int)(month - FloorDivide(month, 12) * 12) + 1;
+  first.day   = 1;
+
+  /* Julian day numbers of the first of the month and of the year limits. */
+  DateTime limit = {DATETIME_CHECK_YEAR_MIN, 1, 1, 0, 0, 0};
+  long long low  = (long long)(GregorianCalendarDateToJulianDate(limit) + 0.5);
+
+  limit.year  = DATETIME_CHECK_YEAR_MAX;
+  limit.month = 12;
+  limit.day   = 31;
+
+  long long high = (long long)(GregorianCalendarDateToJulianDate(limit) + 0.5);
+  long long day  = (long long)(GregorianCalendarDateToJulianDate(first) + 0.5) + (time.day - 1LL) +
+                   FloorDivide(second, 86400);
+
+  second -= FloorDivide(second, 86400) * 86400;
+
+  if(day < low)
+  {
+    day    = low;
+    second = 0;
+  }
+  else if(day > high)
+  {
+    day    = high;
+    second = 86399;
+  }
+
+  DateTime date = JulianDateToGregorianCalendarDate(day - 0.5);
+
+  date.hour   = (int)(second / 3600);
+  date.minute = (int)(second / 60 % 60);
+  date.second = (int)(second % 60);
+
+  return date;
+}
@@ -0,0 +1,81 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeCheck.h
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Header file for DateTimeCheck.c module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+
+#ifndef __DATETIMECHECK_H
+#define __DATETIMECHECK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Header includes -----------------------------------------------------------*/
+#include "DateTime.h"
+#include <stddef.h>
+
+/* Macro definitions ---------------------------------------------------------*/
+#ifndef DATETIME_CHECK_YEAR_MIN
+#define DATETIME_CHECK_YEAR_MIN (-4712) /*!< Smallest valid year, the first whole year of positive julian days. */
+#endif
+
+#ifndef DATETIME_CHECK_YEAR_MAX
+#define DATETIME_CHECK_YEAR_MAX (9999)  /*!< Largest valid year. */
+#endif
+
+/* Type definitions ----------------------------------------------------------*/
+
+/*
+ * A gregorian calendar date is valid when the year is within the limits
+ * above, month, day, hour and minute are within their calendar ranges and
+ * second is 0 to 59. Second 60 is accepted only at 23:59 on 30 June or
+ * 31 December, where leap seconds are inserted.
+ */
+typedef enum
+{
+  DATETIME_SANITIZE_CLAMP = 0,    /*!< Clamp every field into its range. */
+  DATETIME_SANITIZE_NORMALIZE     /*!< Carry overflowing fields, e.g. 31 February to 3 March. */
+}DateTimeSanitize;
+
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+int GregorianCalendarDateIsValid(DateTime time);
+int GpsWeekSecondIsValid(GpsWeekSecond time);
+
+size_t GregorianCalendarDateCheck(const DateTime *time, size_t size, unsigned long long *mask);
+
+DateTime GregorianCalendarDateSanitize(DateTime time, DateTimeSanitize mode);
+size_t GregorianCalendarDateSanitizeArray(DateTime *time, size_t size, DateTimeSanitize mode);
+
+/* Function definitions ------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DATETIMECHECK_H */
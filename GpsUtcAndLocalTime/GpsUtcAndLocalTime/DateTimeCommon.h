@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeCommon.h
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Helpers shared by the DateTime modules.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+#ifndef __DATETIMECOMMON_H
+#define __DATETIMECOMMON_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Header includes -----------------------------------------------------------*/
+#include "DateTime.h"
+
+/* Macro definitions ---------------------------------------------------------*/
+#if defined(_MSC_VER)
+#define DATETIME_INLINE static __inline
+#else
+#define DATETIME_INLINE static inline
+#endif
+
+#define GPS_EPOCH_JD    (2444244.5)   /*!< 1980-01-06 00:00:00 as julian date. */
+#define GPS_EPOCH_MJD   (44244.0)     /*!< 1980-01-06 00:00:00 as modified julian date. */
+#define GPS_EPOCH_UNIX  (315964800LL) /*!< 1980-01-06 00:00:00 in seconds since 1970-01-01. */
+#define UNIX_EPOCH_JD   (2440587.5)   /*!< 1970-01-01 00:00:00 as julian date. */
+#define UNIX_EPOCH_MJD  (40587.0)     /*!< 1970-01-01 00:00:00 as modified julian date. */
+
+/* Type definitions ----------------------------------------------------------*/
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+/* Function definitions ------------------------------------------------------*/
+
+/**
+  * @brief  Division rounded toward negative infinity.
+  * @param  [in] a: Dividend.
+  * @param  [in] b: Divisor, positive.
+  * @return Quotient.
+  */
+DATETIME_INLINE long long FloorDivide(long long a, long long b)
+{
+  long long q = a / b;
+
+  return ((a % b) < 0) ? (q - 1) : q;
+}
+
+/**
+  * @brief  Whether a year is a gregorian leap year.
+  * @param  [in] year: Year.
+  * @return 1 if leap year, 0 if not.
+  */
+DATETIME_INLINE int IsLeapYear(int year)
+{
+  return ((year % 4 == 0) && (year % 100 != 0)) || (year % 400 == 0);
+}
+
+/**
+  * @brief  Gps week and second to packed epoch.
+  * @param  [in] time: Gps week and second.
+  * @return Seconds since the gps epoch.
+  */
+DATETIME_INLINE long long GpsWeekSecondToGpsSecond(GpsWeekSecond time)
+{
+  return time.week * 604800LL + time.second;
+}
+
+/**
+  * @brief  Packed epoch to gps week and second.
+  * @param  [in] second: Seconds since the gps epoch.
+  * @return Gps week and second, the week is negative before the gps epoch.
+  */
+DATETIME_INLINE GpsWeekSecond GpsSecondToGpsWeekSecond(long long second)
+{
+  GpsWeekSecond time = {0};
+  long long     week = FloorDivide(second, 604800);
+
+  time.week   = (int)week;
+  time.second = (int)(second - week * 604800);
+
+  return time;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DATETIMECOMMON_H */
@@ -0,0 +1,246 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeNow.c
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Current time in utc, gps, tai and modified julian date.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+/* Header includes -----------------------------------------------------------*/
+#if !defined(_WIN32) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "DateTimeNow.h"
+#include "DateTimeCommon.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/* Macro definitions ---------------------------------------------------------*/
+#if defined(_MSC_VER)
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL __thread
+#endif
+
+/* Type definitions ----------------------------------------------------------*/
+typedef enum
+{
+  SCALE_UTC = 0,
+  SCALE_GPS,
+  SCALE_TAI,
+  SCALE_COUNT
+}Scale;
+
+/* Calendar date of the day [start, end) in seconds since 1970-01-01. */
+typedef struct
+{
+  long long start;
+  long long end;
+  DateTime  date;
+}DayCache;
+
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+static THREAD_LOCAL DayCache dayCache[SCALE_COUNT];
+
+/* Function declarations -----------------------------------------------------*/
+static long long ReadClock(long *nanosecond);
+static DateTime SecondToDateTime(long long second, Scale scale);
+static double UnixToModifiedJulianDate(long long second, long nanosecond);
+
+/* Function definitions ------------------------------------------------------*/
+
+/**
+  * @brief  Current utc.
+  * @param  [out] nanosecond: Nanoseconds within the second, may be NULL.
+  * @return Gregorian calendar date.
+  */
+DateTime NowUtc(long *nanosecond)
+{
+  return SecondToDateTime(ReadClock(nanosecond), SCALE_UTC);
+}
+
+/**
+  * @brief  Current gps time.
+  * @param  [out] nanosecond: Nanoseconds within the second, may be NULL.
+  * @return Gregorian calendar date.
+  */
+DateTime NowGps(long *nanosecond)
+{
+  return SecondToDateTime(ReadClock(nanosecond) + DATETIME_NOW_GPS_UTC_OFFSET, SCALE_GPS);
+}
+
+/**
+  * @brief  Current tai.
+  * @param  [out] nanosecond: Nanoseconds within the second, may be NULL.
+  * @return Gregorian calendar date.
+  */
+DateTime NowTai(long *nanosecond)
+{
+  return SecondToDateTime(ReadClock(nanosecond) + DATETIME_NOW_GPS_UTC_OFFSET + DATETIME_NOW_TAI_GPS_OFFSET, SCALE_TAI);
+}
+
+/**
+  * @brief  Current gps week and second.
+  * @param  [out] nanosecond: Nanoseconds within the second, may be NULL.
+  * @return Gps week and second.
+  */
+GpsWeekSecond NowGpsWeekSecond(long *nanosecond)
+{
+  return GpsSecondToGpsWeekSecond(ReadClock(nanosecond) + DATETIME_NOW_GPS_UTC_OFFSET - GPS_EPOCH_UNIX);
+}
+
+/**
+  * @brief  Current utc as modified julian date.
+  * @param  None.
+  * @return Modified julian date.
+  */
+double NowModifiedJulianDate(void)
+{
+  long      nanosecond = 0;
+  long long second     = ReadClock(&nanosecond);
+
+  return UnixToModifiedJulianDate(second, nanosecond);
+}
+
+/**
+  * @brief  Read the clock once and convert the sample to every time scale.
+  * @param  [out] now: Utc, gps, tai, gps week and second and modified julian date.
+  * @return None.
+  */
+void NowTimeRead(NowTime *now)
+{
+  long      nanosecond = 0;
+  long long second     = ReadClock(&nanosecond);
+
+  NowTimeFromUnix(second, nanosecond, now);
+}
+
+/**
+  * @brief  Convert one utc sample to every time scale.
+  * @param  [in]  second:     Seconds since 1970-01-01 00:00:00 utc, leap seconds excluded.
+  * @param  [in]  nanosecond: Nanoseconds within the second.
+  * @param  [out] now:        Utc, gps, tai, gps week and second and modified julian date.
+  * @return None.
+  */
+void NowTimeFromUnix(long long second, long nanosecond, NowTime *now)
+{
+  long long gps = second + DATETIME_NOW_GPS_UTC_OFFSET;
+
+  now->utc           = SecondToDateTime(second, SCALE_UTC);
+  now->gps           = SecondToDateTime(gps, SCALE_GPS);
+  now->tai           = SecondToDateTime(gps + DATETIME_NOW_TAI_GPS_OFFSET, SCALE_TAI);
+  now->gpsWeekSecond = GpsSecondToGpsWeekSecond(gps - GPS_EPOCH_UNIX);
+  now->mjd           = UnixToModifiedJulianDate(second, nanosecond);
+  now->nanosecond    = nanosecond;
+}
+
+/**
+  * @brief  Read the system clock as utc.
+  * @param  [out] nanosecond: Nanoseconds within the second, may be NULL.
+  * @return Seconds since 1970-01-01 00:00:00 utc, leap seconds excluded.
+  */
+static long long ReadClock(long *nanosecond)
+{
+#if defined(_WIN32)
+  FILETIME  fileTime = {0};
+
+  GetSystemTimePreciseAsFileTime(&fileTime);
+
+  /* 100 ns ticks since 1601-01-01. */
+  long long tick   = ((long long)fileTime.dwHighDateTime << 32) | fileTime.dwLowDateTime;
+  long long second = tick / 10000000 - 11644473600LL;
+
+  if(nanosecond != NULL)
+  {
+    *nanosecond = (long)(tick % 10000000) * 100;
+  }
+
+  return second;
+#else
+  struct timespec now = {0};
+
+#if defined(DATETIME_NOW_CLOCK_TAI)
+  clock_gettime(CLOCK_TAI, &now);
+  now.tv_sec -= DATETIME_NOW_GPS_UTC_OFFSET + DATETIME_NOW_TAI_GPS_OFFSET;
+#else
+  clock_gettime(CLOCK_REALTIME, &now);
+#endif
+
+  if(nanosecond != NULL)
+  {
+    *nanosecond = now.tv_nsec;
+  }
+
+  return (long long)now.tv_sec;
+#endif
+}
+
+/**
+  * @brief  Seconds since 1970-01-01 to gregorian calendar date.
+  * @param  [in] second: Seconds since 1970-01-01 in the time scale.
+  * @param  [in] scale:  Time scale, selects the day cache of the thread.
+  * @return Gregorian calendar date.
+  * @note   Only the first call of each day goes through the calendar, the
+  *         rest is a subtraction and a few divisions.
+  */
+static DateTime SecondToDateTime(long long second, Scale scale)
+{
+  DayCache *cache = &dayCache[scale];
+
+  if((second < cache->start) || (second >= cache->end))
+  {
+    long long day = FloorDivide(second, 86400);
+
+    cache->start = day * 86400;
+    cache->end   = cache->start + 86400;
+    cache->date  = JulianDateToGregorianCalendarDate(UNIX_EPOCH_JD + day);
+  }
+
+  DateTime time = cache->date;
+  int      sod  = (int)(second - cache->start);
+
+  time.hour   = sod / 3600;
+  time.minute = sod / 60 % 60;
+  time.second = sod % 60;
+
+  return time;
+}
+
+/**
+  * @brief  Seconds since 1970-01-01 to modified julian date.
+  * @param  [in] second:     Seconds since 1970-01-01.
+  * @param  [in] nanosecond: Nanoseconds within the second.
+  * @return Modified julian date.
+  */
+static double UnixToModifiedJulianDate(long long second, long nanosecond)
+{
+  long long day = FloorDivide(second, 86400);
+
+  return UNIX_EPOCH_MJD + day + ((second - day * 86400) + nanosecond / 1000000000.0) / 86400.0;
+}
@@ -0,0 +1,82 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeNow.h
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Header file for DateTimeNow.c module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+#ifndef __DATETIMENOW_H
+#define __DATETIMENOW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Header includes -----------------------------------------------------------*/
+#include "DateTime.h"
+
+/* Macro definitions ---------------------------------------------------------*/
+#ifndef DATETIME_NOW_GPS_UTC_OFFSET
+#define DATETIME_NOW_GPS_UTC_OFFSET (18) /*!< GPS - UTC leap seconds. */
+#endif
+
+#define DATETIME_NOW_TAI_GPS_OFFSET (19) /*!< TAI - GPS seconds, fixed. */
+
+/*
+ * Define DATETIME_NOW_CLOCK_TAI to read CLOCK_TAI instead of CLOCK_REALTIME
+ * on Linux. The kernel TAI offset must then be set, e.g. by ntpd or ptp4l.
+ */
+
+/* Type definitions ----------------------------------------------------------*/
+
+/* Every representation of one clock sample. */
+typedef struct
+{
+  DateTime      utc;
+  DateTime      gps;
+  DateTime      tai;
+  GpsWeekSecond gpsWeekSecond;
+  double        mjd;        /*!< Utc as modified julian date. */
+  long          nanosecond; /*!< Nanoseconds within the second, shared by all. */
+}NowTime;
+
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+DateTime NowUtc(long *nanosecond);
+DateTime NowGps(long *nanosecond);
+DateTime NowTai(long *nanosecond);
+GpsWeekSecond NowGpsWeekSecond(long *nanosecond);
+double NowModifiedJulianDate(void);
+
+void NowTimeRead(NowTime *now);
+void NowTimeFromUnix(long long second, long nanosecond, NowTime *now);
+
+/* Function definitions ------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DATETIMENOW_H */
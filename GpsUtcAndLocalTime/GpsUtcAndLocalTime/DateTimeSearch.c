@@ -0,0 +1,448 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeSearch.c
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Search module for sorted epoch arrays.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+/* Header includes -----------------------------------------------------------*/
+#include "DateTimeSearch.h"
+#include "DateTimeCommon.h"
+
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
+/* Macro definitions ---------------------------------------------------------*/
+#if defined(_MSC_VER)
+#define PREFETCH(address) _mm_prefetch((const char *)(address), _MM_HINT_T0)
+#else
+#define PREFETCH(address) __builtin_prefetch(address)
+#endif
+
+/* Below this many elements the interpolation search finishes with bisection. */
+#define INTERPOLATION_MIN_SIZE (16)
+
+/* Type definitions ----------------------------------------------------------*/
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+static size_t EytzingerFill(GpsWeekSecondEytzinger *tree, const GpsWeekSecond *array, size_t i, size_t k);
+
+/* Function definitions ------------------------------------------------------*/
+
+/**
+  * @brief  Find the first element not earlier than the time.
+  * @param  [in] array: Gps week and second array, sorted in ascending order.
+  * @param  [in] size:  The number of elements in the array.
+  * @param  [in] time:  Gps week and second to search.
+  * @return Index of the element, size if all elements are earlier.
+  */
+size_t GpsWeekSecondLowerBound(const GpsWeekSecond *array, size_t size, GpsWeekSecond time)
+{
+  if(size == 0)
+  {
+    return 0;
+  }
+
+  const GpsWeekSecond *base = array;
+  long long            key  = GpsWeekSecondToGpsSecond(time);
+
+  while(size > 1)
+  {
+    size_t half = size / 2;
+
+    base  = (GpsWeekSecondToGpsSecond(base[half]) < key) ? (base + half) : base;
+    size -= half;
+  }
+
+  return (size_t)(base - array) + (GpsWeekSecondToGpsSecond(*base) < key);
+}
+
+/**
+  * @brief  Find the first element later than the time.
+  * @param  [in] array: Gps week and second array, sorted in ascending order.
+  * @param  [in] size:  The number of elements in the array.
+  * @param  [in] time:  Gps week and second to search.
+  * @return Index of the element, size if no element is later.
+  */
+size_t GpsWeekSecondUpperBound(const GpsWeekSecond *array, size_t size, GpsWeekSecond time)
+{
+  if(size == 0)
+  {
+    return 0;
+  }
+
+  const GpsWeekSecond *base = array;
+  long long            key  = GpsWeekSecondToGpsSecond(time);
+
+  while(size > 1)
+  {
+    size_t half = size / 2;
+
+    base  = (GpsWeekSecondToGpsSecond(base[half]) <= key) ? (base + half) : base;
+    size -= half;
+  }
+
+  return (size_t)(base - array) + (GpsWeekSecondToGpsSecond(*base) <= key);
+}
+
+/**
+  * @brief  Find the element nearest to the time.
+  * @param  [in] array: Gps week and second array, sorted in ascending order.
+  * @param  [in] size:  The number of elements in the array.
+  * @param  [in] time:  Gps week and second to search.
+  * @return Index of the element, the earlier one on a tie, 0 if the array is empty.
+  */
+size_t GpsWeekSecondNearest(const GpsWeekSecond *array, size_t size, GpsWeekSecond time)
+{
+  size_t index = GpsWeekSecondLowerBound(array, size, time);
+
+  if(index == 0)
+  {
+    return 0;
+  }
+
+  if(index == size)
+  {
+    return size - 1;
+  }
+
+  long long key = GpsWeekSecondToGpsSecond(time);
+
+  if((key - GpsWeekSecondToGpsSecond(array[index - 1])) <= (GpsWeekSecondToGpsSecond(array[index]) - key))
+  {
+    return index - 1;
+  }
+  else
+  {
+    return index;
+  }
+}
+
+/**
+  * @brief  Find the first element not earlier than the time by interpolation.
+  * @param  [in] array: Gps week and second array, sorted in ascending order.
+  * @param  [in] size:  The number of elements in the array.
+  * @param  [in] time:  Gps week and second to search.
+  * @return Index of the element, size if all elements are earlier.
+  * @note   Takes O(log log n) probes when the array is sampled at a nearly constant rate.
+  */
+size_t GpsWeekSecondInterpolationLowerBound(const GpsWeekSecond *array, size_t size, GpsWeekSecond time)
+{
+  size_t    low  = 0;
+  size_t    high = size;
+  long long key  = GpsWeekSecondToGpsSecond(time);
+
+  while((high - low) > INTERPOLATION_MIN_SIZE)
+  {
+    long long first = GpsWeekSecondToGpsSecond(array[low]);
+    long long last  = GpsWeekSecondToGpsSecond(array[high - 1]);
+
+    if(key <= first)
+    {
+      return low;
+    }
+
+    if(key > last)
+    {
+      return high;
+    }
+
+    size_t probe = low + (size_t)((double)(key - first) / (double)(last - first) * (double)(high - 1 - low));
+
+    if(GpsWeekSecondToGpsSecond(array[probe]) < key)
+    {
+      low = probe + 1;
+    }
+    else
+    {
+      high = probe;
+    }
+  }
+
+  return low + GpsWeekSecondLowerBound(array + low, high - low, time);
+}
+
+/**
+  * @brief  Find the lower bound of many times in a single pass.
+  * @param  [in]  array: Gps week and second array, sorted in ascending order.
+  * @param  [in]  size:  The number of elements in the array.
+  * @param  [in]  time:  Gps week and second to search, sorted in ascending order.
+  * @param  [in]  count: The number of times to search.
+  * @param  [out] index: The lower bound of each time, count elements.
+  * @return None.
+  */
+void GpsWeekSecondLowerBoundBatch(const GpsWeekSecond *array, size_t size,
+                                  const GpsWeekSecond *time, size_t count, size_t *index)
+{
+  size_t position = 0;
+
+  for(size_t i = 0; i < count; i++)
+  {
+    long long key  = GpsWeekSecondToGpsSecond(time[i]);
+    size_t    step = 1;
+
+    /* Gallop forward from the previous result, then bisect the last step. */
+    while(((position + step) <= size) && (GpsWeekSecondToGpsSecond(array[position + step - 1]) < key))
+    {
+      position += step;
+      step     *= 2;
+    }
+
+    size_t limit = ((position + step) <= size) ? step : (size - position);
+
+    position += GpsWeekSecondLowerBound(array + position, limit, time[i]);
+    index[i]  = position;
+  }
+}
+
+/**
+  * @brief  Build the eytzinger layout of a sorted array.
+  * @param  [out] tree:  Eytzinger layout, key and rank must hold size + 1 elements
+  *                      and key must be 64-byte aligned.
+  * @param  [in]  array: Gps week and second array, sorted in ascending order.
+  * @param  [in]  size:  The number of elements in the array, less than 2^32.
+  * @return None.
+  */
+void GpsWeekSecondEytzingerBuild(GpsWeekSecondEytzinger *tree, const GpsWeekSecond *array, size_t size)
+{
+  tree->size = size;
+
+  EytzingerFill(tree, array, 0, 1);
+}
+
+/**
+  * @brief  Find the first element not earlier than the time in the eytzinger layout.
+  * @param  [in] tree: Eytzinger layout.
+  * @param  [in] time: Gps week and second to search.
+  * @return Index of the element in the sorted array, size if all elements are earlier.
+  */
+size_t GpsWeekSecondEytzingerLowerBound(const GpsWeekSecondEytzinger *tree, GpsWeekSecond time)
+{
+  long long key = GpsWeekSecondToGpsSecond(time);
+  size_t    k   = 1;
+
+  while(k <= tree->size)
+  {
+    /* The 16 descendants four levels down fill two cache lines. */
+    PREFETCH(tree->key + 16 * k);
+    PREFETCH(tree->key + 16 * k + 8);
+    k = 2 * k + (tree->key[k] < key);
+  }
+
+  /* Undo the right turns and the final left turn to reach the answer. */
+  while(k & 1)
+  {
+    k >>= 1;
+  }
+
+  k >>= 1;
+
+  return (k == 0) ? tree->size : tree->rank[k];
+}
+
+/**
+  * @brief  Find the first element not earlier than the modified julian date.
+  * @param  [in] array: Modified julian date array, sorted in ascending order.
+  * @param  [in] size:  The number of elements in the array.
+  * @param  [in] mjd:   Modified julian date to search.
+  * @return Index of the element, size if all elements are earlier.
+  */
+size_t ModifiedJulianDateLowerBound(const double *array, size_t size, double mjd)
+{
+  if(size == 0)
+  {
+    return 0;
+  }
+
+  const double *base = array;
+
+  while(size > 1)
+  {
+    size_t half = size / 2;
+
+    base  = (base[half] < mjd) ? (base + half) : base;
+    size -= half;
+  }
+
+  return (size_t)(base - array) + (*base < mjd);
+}
+
+/**
+  * @brief  Find the first element later than the modified julian date.
+  * @param  [in] array: Modified julian date array, sorted in ascending order.
+  * @param  [in] size:  The number of elements in the array.
+  * @param  [in] mjd:   Modified julian date to search.
+  * @return Index of the element, size if no element is later.
+  */
+size_t ModifiedJulianDateUpperBound(const double *array, size_t size, double mjd)
+{
+  if(size == 0)
+  {
+    return 0;
+  }
+
+  const double *base = array;
+
+  while(size > 1)
+  {
+    size_t half = size / 2;
+
+    base  = (base[half] <= mjd) ? (base + half) : base;
+    size -= half;
+  }
+
+  return (size_t)(base - array) + (*base <= mjd);
+}
+
+/**
+  * @brief  Find the element nearest to the modified julian date.
+  * @param  [in] array: Modified julian date array, sorted in ascending order.
+  * @param  [in] size:  The number of elements in the array.
+  * @param  [in] mjd:   Modified julian date to search.
+  * @return Index of the element, the earlier one on a tie, 0 if the array is empty.
+  */
+size_t ModifiedJulianDateNearest(const double *array, size_t size, double mjd)
+{
+  size_t index = ModifiedJulianDateLowerBound(array, size, mjd);
+
+  if(index == 0)
+  {
+    return 0;
+  }
+
+  if(index == size)
+  {
+    return size - 1;
+  }
+
+  if((mjd - array[index - 1]) <= (array[index] - mjd))
+  {
+    return index - 1;
+  }
+  else
+  {
+    return index;
+  }
+}
+
+/**
+  * @brief  Find the first element not earlier than the modified julian date by interpolation.
+  * @param  [in] array: Modified julian date array, sorted in ascending order.
+  * @param  [in] size:  The number of elements in the array.
+  * @param  [in] mjd:   Modified julian date to search.
+  * @return Index of the element, size if all elements are earlier.
+  * @note   Takes O(log log n) probes when the array is sampled at a nearly constant rate.
+  */
+size_t ModifiedJulianDateInterpolationLowerBound(const double *array, size_t size, double mjd)
+{
+  size_t low  = 0;
+  size_t high = size;
+
+  while((high - low) > INTERPOLATION_MIN_SIZE)
+  {
+    double first = array[low];
+    double last  = array[high - 1];
+
+    if(mjd <= first)
+    {
+      return low;
+    }
+
+    if(mjd > last)
+    {
+      return high;
+    }
+
+    size_t probe = low + (size_t)((mjd - first) / (last - first) * (double)(high - 1 - low));
+
+    if(array[probe] < mjd)
+    {
+      low = probe + 1;
+    }
+    else
+    {
+      high = probe;
+    }
+  }
+
+  return low + ModifiedJulianDateLowerBound(array + low, high - low, mjd);
+}
+
+/**
+  * @brief  Find the lower bound of many modified julian dates in a single pass.
+  * @param  [in]  array: Modified julian date array, sorted in ascending order.
+  * @param  [in]  size:  The number of elements in the array.
+  * @param  [in]  mjd:   Modified julian dates to search, sorted in ascending order.
+  * @param  [in]  count: The number of modified julian dates to search.
+  * @param  [out] index: The lower bound of each modified julian date, count elements.
+  * @return None.
+  */
+void ModifiedJulianDateLowerBoundBatch(const double *array, size_t size,
+                                       const double *mjd, size_t count, size_t *index)
+{
+  size_t position = 0;
+
+  for(size_t i = 0; i < count; i++)
+  {
+    size_t step = 1;
+
+    /* Gallop forward from the previous result, then bisect the last step. */
+    while(((position + step) <= size) && (array[position + step - 1] < mjd[i]))
+    {
+      position += step;
+      step     *= 2;
+    }
+
+    size_t limit = ((position + step) <= size) ? step : (size - position);
+
+    position += ModifiedJulianDateLowerBound(array + position, limit, mjd[i]);
+    index[i]  = position;
+  }
+}
+
+/**
+  * @brief  Fill the eytzinger layout by an in-order walk.
+  * @param  [out] tree:  Eytzinger layout.
+  * @param  [in]  array: Sorted array.
+  * @param  [in]  i:     Next sorted index to place.
+  * @param  [in]  k:     Current eytzinger index.
+  * @return Next sorted index to place.
+  */
+static size_t EytzingerFill(GpsWeekSecondEytzinger *tree, const GpsWeekSecond *array, size_t i, size_t k)
+{
+  if(k <= tree->size)
+  {
+    i = EytzingerFill(tree, array, i, 2 * k);
+
+    tree->key[k]  = GpsWeekSecondToGpsSecond(array[i]);
+    tree->rank[k] = (unsigned int)i;
+    i++;
+
+    i = EytzingerFill(tree, array, i, 2 * k + 1);
+  }
+
+  return i;
+}
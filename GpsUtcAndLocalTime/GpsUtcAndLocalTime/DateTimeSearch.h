@@ -0,0 +1,81 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeSearch.h
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Header file for DateTimeSearch.c module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+#ifndef __DATETIMESEARCH_H
+#define __DATETIMESEARCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Header includes -----------------------------------------------------------*/
+#include "DateTime.h"
+#include <stddef.h>
+
+/* Macro definitions ---------------------------------------------------------*/
+/* Type definitions ----------------------------------------------------------*/
+
+/*
+ * Sorted gps week and second array in eytzinger (breadth first) layout.
+ * key must be 64-byte aligned so the descendants of a node four levels
+ * down start on a cache line boundary.
+ */
+typedef struct
+{
+  long long    *key;  /*!< size + 1 elements, key[0] is unused, 64-byte aligned. */
+  unsigned int *rank; /*!< size + 1 elements, index of key[i] in the sorted array. */
+  size_t        size;
+}GpsWeekSecondEytzinger;
+
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+size_t GpsWeekSecondLowerBound(const GpsWeekSecond *array, size_t size, GpsWeekSecond time);
+size_t GpsWeekSecondUpperBound(const GpsWeekSecond *array, size_t size, GpsWeekSecond time);
+size_t GpsWeekSecondNearest(const GpsWeekSecond *array, size_t size, GpsWeekSecond time);
+size_t GpsWeekSecondInterpolationLowerBound(const GpsWeekSecond *array, size_t size, GpsWeekSecond time);
+void GpsWeekSecondLowerBoundBatch(const GpsWeekSecond *array, size_t size,
+                                  const GpsWeekSecond *time, size_t count, size_t *index);
+
+void GpsWeekSecondEytzingerBuild(GpsWeekSecondEytzinger *tree, const GpsWeekSecond *array, size_t size);
+size_t GpsWeekSecondEytzingerLowerBound(const GpsWeekSecondEytzinger *tree, GpsWeekSecond time);
+
+size_t ModifiedJulianDateLowerBound(const double *array, size_t size, double mjd);
+size_t ModifiedJulianDateUpperBound(const double *array, size_t size, double mjd);
+size_t ModifiedJulianDateNearest(const double *array, size_t size, double mjd);
+size_t ModifiedJulianDateInterpolationLowerBound(const double *array, size_t size, double mjd);
+void ModifiedJulianDateLowerBoundBatch(const double *array, size_t size,
+                                       const double *mjd, size_t count, size_t *index);
+
+/* Function definitions ------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DATETIMESEARCH_H */
@@ -0,0 +1,279 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeTable.c
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Lookup table backend for gregorian calendar date conversion.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+/* Header includes -----------------------------------------------------------*/
+#include "DateTimeTable.h"
+#include "DateTimeCommon.h"
+
+/* Macro definitions ---------------------------------------------------------*/
+#if defined(_MSC_VER)
+#define DATETIME_TABLE_ALIGN __declspec(align(64))
+#else
+#define DATETIME_TABLE_ALIGN __attribute__((aligned(64)))
+#endif
+
+/* A year is longer than a block, so a block touches at most two years. */
+#define BLOCK_SHIFT       (8)
+#define BLOCK_TABLE_SIZE  (((DATETIME_TABLE_MAX_YEAR_COUNT * 366) >> BLOCK_SHIFT) + 1)
+
+/* Type definitions ----------------------------------------------------------*/
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+static int          tableMinYear   = 0;
+static unsigned int tableYearCount = 0;
+static int          tableFirstJdn  = 0;
+static int          tableLastJdn   = 0;
+
+/* Julian day number of January 1 for every year in range, plus one sentinel. */
+static DATETIME_TABLE_ALIGN int yearStartTable[DATETIME_TABLE_MAX_YEAR_COUNT + 1];
+
+static DATETIME_TABLE_ALIGN unsigned char leapYearTable[DATETIME_TABLE_MAX_YEAR_COUNT];
+
+/* Year index of the first day of every block of days from tableFirstJdn. */
+static DATETIME_TABLE_ALIGN unsigned short blockYearTable[BLOCK_TABLE_SIZE];
+
+/* Month index, 0 to 11, of every day of the year. */
+static DATETIME_TABLE_ALIGN unsigned char dayMonthTable[2][368];
+
+/* Days before each month, the thirteenth entry is the length of the year. */
+static DATETIME_TABLE_ALIGN const short monthOffsetTable[2][16] =
+{
+  {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334, 365},
+  {0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335, 366}
+};
+
+static DATETIME_TABLE_ALIGN const unsigned char monthDayTable[2][16] =
+{
+  {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31},
+  {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31}
+};
+
+/* Function declarations -----------------------------------------------------*/
+
+/* Function definitions ------------------------------------------------------*/
+
+/**
+  * @brief  Build the lookup tables for a range of years.
+  * @param  [in] minYear: The first year covered by the tables.
+  * @param  [in] maxYear: The last year covered by the tables.
+  * @return 0 on success, -1 if the range is empty or larger than DATETIME_TABLE_MAX_YEAR_COUNT.
+  * @note   Years outside the range are converted by the arithmetic functions of DateTime.c.
+  */
+int DateTimeTableInit(int minYear, int maxYear)
+{
+  if((maxYear < minYear) || ((maxYear - minYear) >= DATETIME_TABLE_MAX_YEAR_COUNT))
+  {
+    return -1;
+  }
+
+  DateTime     time  = {.year = minYear, .month = 1, .day = 1, .hour = 12, .minute = 0, .second = 0};
+  unsigned int count = (unsigned int)(maxYear - minYear + 1);
+  int          jdn   = (int)GregorianCalendarDateToJulianDate(time);
+
+  tableYearCount = 0;
+
+  for(unsigned int i = 0; i < count; i++)
+  {
+    int leap = IsLeapYear(minYear + (int)i);
+
+    yearStartTable[i] = jdn;
+    leapYearTable[i]  = (unsigned char)leap;
+    jdn              += monthOffsetTable[leap][12];
+  }
+
+  yearStartTable[count] = jdn;
+
+  for(unsigned int i = 0, index = 0; (i << BLOCK_SHIFT) < (unsigned int)(jdn - yearStartTable[0]); i++)
+  {
+    while(yearStartTable[index + 1] <= yearStartTable[0] + (int)(i << BLOCK_SHIFT))
+    {
+      index++;
+    }
+
+    blockYearTable[i] = (unsigned short)index;
+  }
+
+  for(int leap = 0; leap < 2; leap++)
+  {
+    for(int month = 0; month < 12; month++)
+    {
+      for(int yday = monthOffsetTable[leap][month]; yday < monthOffsetTable[leap][month + 1]; yday++)
+      {
+        dayMonthTable[leap][yday] = (unsigned char)month;
+      }
+    }
+  }
+
+  tableMinYear   = minYear;
+  tableFirstJdn  = yearStartTable[0];
+  tableLastJdn   = yearStartTable[count];
+  tableYearCount = count;
+
+  return 0;
+}
+
+/**
+  * @brief  Gregorian calendar days in month.
+  * @param  [in] year:  Year.
+  * @param  [in] month: Month, 1 to 12.
+  * @return The number of days in the month, 0 if the month is out of range.
+  */
+int GregorianCalendarDateDaysInMonthTable(int year, int month)
+{
+  unsigned int index = (unsigned int)(year - tableMinYear);
+  int          leap  = 0;
+
+  if((unsigned int)(month - 1) > 11)
+  {
+    return 0;
+  }
+
+  if(index < tableYearCount)
+  {
+    leap = leapYearTable[index];
+  }
+  else
+  {
+    leap = IsLeapYear(year);
+  }
+
+  return monthDayTable[leap][month - 1];
+}
+
+/**
+  * @brief  Gregorian calendar date add month.
+  * @param  [in] time:  Gregorian calendar date.
+  * @param  [in] month: The number of month to add.
+  * @return Gregorian calendar date.
+  * @note   The month is carried with floor division, so negative month
+  *         counts move back into earlier years.
+  */
+DateTime GregorianCalendarDateAddMonthTable(DateTime time, int month)
+{
+  long long total = time.year * 12LL + (time.month - 1) + month;
+  long long year  = FloorDivide(total, 12);
+
+  time.year  = (int)year;
+  time.month = (int)(total - year * 12) + 1;
+
+  int mday = GregorianCalendarDateDaysInMonthTable(time.year, time.month);
+
+  if(time.day > mday)
+  {
+    time.month += 1;
+    time.day   -= mday;
+
+    if(time.month > 12)
+    {
+      time.year  += 1;
+      time.month -= 12;
+    }
+  }
+
+  return time;
+}
+
+/**
+  * @brief  Gregorian calendar date to julian date.
+  * @param  [in] time: Gregorian calendar date.
+  * @return Julian date.
+  */
+double GregorianCalendarDateToJulianDateTable(DateTime time)
+{
+  unsigned int index = (unsigned int)(time.year - tableMinYear);
+  unsigned int month = (unsigned int)(time.month - 1);
+
+  if((index >= tableYearCount) || (month > 11))
+  {
+    return GregorianCalendarDateToJulianDate(time);
+  }
+
+  int jdn = yearStartTable[index] + monthOffsetTable[leapYearTable[index]][month] + time.day - 1;
+
+  double jd = jdn + ((time.hour - 12) * 3600.0 + time.minute * 60.0 + time.second) / 86400.0;
+
+  return jd;
+}
+
+/**
+  * @brief  Gregorian calendar date to modified julian date.
+  * @param  [in] time: Gregorian calendar date.
+  * @return Modified julian date.
+  */
+double GregorianCalendarDateToModifiedJulianDateTable(DateTime time)
+{
+  return GregorianCalendarDateToJulianDateTable(time) - 2400000.5;
+}
+
+/**
+  * @brief  Julian date to gregorian calendar date.
+  * @param  [in] jd: Julian date.
+  * @return Gregorian calendar date.
+  */
+DateTime JulianDateToGregorianCalendarDateTable(double jd)
+{
+  int jdn = (int)(jd + 0.5);
+
+  if((jdn < tableFirstJdn) || (jdn >= tableLastJdn))
+  {
+    return JulianDateToGregorianCalendarDate(jd);
+  }
+
+  unsigned int day   = (unsigned int)(jdn - tableFirstJdn);
+  unsigned int index = blockYearTable[day >> BLOCK_SHIFT];
+
+  index += (yearStartTable[index + 1] <= jdn);
+
+  int leap  = leapYearTable[index];
+  int yday  = jdn - yearStartTable[index];
+  int month = dayMonthTable[leap][yday];
+
+  /* Same rounding as DateTime.c, the integer steps are exact. */
+  int second = (int)((jd + 0.5 - jdn) * 86400.5);
+
+  DateTime time = {0};
+
+  time.year   = tableMinYear + (int)index;
+  time.month  = month + 1;
+  time.day    = yday - monthOffsetTable[leap][month] + 1;
+  time.hour   = second / 3600;
+  time.minute = (second - time.hour * 3600) / 60;
+  time.second = second - time.hour * 3600 - time.minute * 60;
+
+  return time;
+}
+
+/**
+  * @brief  Modified julian date to gregorian calendar date.
+  * @param  [in] mjd: Modified julian date.
+  * @return Gregorian calendar date.
+  */
+DateTime ModifiedJulianDateToGregorianCalendarDateTable(double mjd)
+{
+  return JulianDateToGregorianCalendarDateTable(mjd + 2400000.5);
+}
@@ -0,0 +1,64 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeTable.h
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Header file for DateTimeTable.c module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+#ifndef __DATETIMETABLE_H
+#define __DATETIMETABLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Header includes -----------------------------------------------------------*/
+#include "DateTime.h"
+
+/* Macro definitions ---------------------------------------------------------*/
+#ifndef DATETIME_TABLE_MAX_YEAR_COUNT
+#define DATETIME_TABLE_MAX_YEAR_COUNT (1024)
+#endif
+
+/* Type definitions ----------------------------------------------------------*/
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+int DateTimeTableInit(int minYear, int maxYear);
+
+int GregorianCalendarDateDaysInMonthTable(int year, int month);
+DateTime GregorianCalendarDateAddMonthTable(DateTime time, int month);
+double GregorianCalendarDateToJulianDateTable(DateTime time);
+double GregorianCalendarDateToModifiedJulianDateTable(DateTime time);
+
+DateTime JulianDateToGregorianCalendarDateTable(double jd);
+DateTime ModifiedJulianDateToGregorianCalendarDateTable(double mjd);
+
+/* Function definitions ------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DATETIMETABLE_H */
@@ -0,0 +1,253 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeWide.c
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   64-bit day and second counts from a selectable epoch.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+/* Header includes -----------------------------------------------------------*/
+#include "DateTimeWide.h"
+#include "DateTimeCommon.h"
+
+/* Macro definitions ---------------------------------------------------------*/
+#define CIVIL_EPOCH_JDN  (1721120LL) /*!< Julian day number of 0000-03-01. */
+
+/* Type definitions ----------------------------------------------------------*/
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+
+/* Seconds from the midnight starting julian day number 0 to each epoch. */
+static const long long epochOffset[] =
+{
+  2444245LL * 86400,         /* DATETIME_EPOCH_GPS */
+  2440588LL * 86400,         /* DATETIME_EPOCH_UNIX */
+  2451545LL * 86400 + 43200, /* DATETIME_EPOCH_J2000 */
+  2400001LL * 86400          /* DATETIME_EPOCH_MJD */
+};
+
+/* Julian day numbers of the first and last day the 32-bit kernels handle. */
+static const long long fastFirstJdn = CIVIL_EPOCH_JDN; /* 0000-03-01 */
+static const long long fastLastJdn  = 366963925LL;     /* 1000000-12-31 */
+
+/* Function declarations -----------------------------------------------------*/
+static long long FastJulianDayNumber(int year, int month, int day);
+static DateTime FastGregorianCalendarDate(unsigned int day);
+
+/* Function definitions ------------------------------------------------------*/
+
+/**
+  * @brief  Gregorian calendar date to julian day number.
+  * @param  [in] time: Gregorian calendar date, the time of day is ignored.
+  * @return Julian day number, the julian date at noon of the day.
+  * @note   Years within DATETIME_WIDE_FAST_YEAR_MIN and
+  *         DATETIME_WIDE_FAST_YEAR_MAX go through a 32-bit kernel, any
+  *         other int year through 64-bit floor arithmetic.
+  */
+long long GregorianCalendarDateToJulianDayNumber(DateTime time)
+{
+  if((time.year >= DATETIME_WIDE_FAST_YEAR_MIN) && (time.year <= DATETIME_WIDE_FAST_YEAR_MAX))
+  {
+    return FastJulianDayNumber(time.year, time.month, time.day);
+  }
+
+  /* Years start on 1 March, so the leap day is the last day of the year. */
+  long long year  = (long long)time.year - (time.month <= 2);
+  long long era   = FloorDivide(year, 400);
+  long long yoe   = year - era * 400;
+  long long month = (time.month > 2) ? (time.month - 3) : (time.month + 9);
+  long long doy   = (153 * month + 2) / 5 + time.day - 1;
+  long long doe   = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+  return era * 146097 + doe + CIVIL_EPOCH_JDN;
+}
+
+/**
+  * @brief  Julian day number to gregorian calendar date.
+  * @param  [in] jdn: Julian day number.
+  * @return Gregorian calendar date at the start of the day.
+  * @note   The year must fit in an int, i.e. jdn within about 7.8e11 days.
+  */
+DateTime JulianDayNumberToGregorianCalendarDate(long long jdn)
+{
+  if((jdn >= fastFirstJdn) && (jdn <= fastLastJdn))
+  {
+    return FastGregorianCalendarDate((unsigned int)(jdn - CIVIL_EPOCH_JDN));
+  }
+
+  long long day = jdn - CIVIL_EPOCH_JDN;
+  long long era = FloorDivide(day, 146097);
+  long long doe = day - era * 146097;
+  long long yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  long long doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  long long mp  = (5 * doy + 2) / 153;
+
+  DateTime time = {0};
+
+  time.day   = (int)(doy - (153 * mp + 2) / 5 + 1);
+  time.month = (int)((mp < 10) ? (mp + 3) : (mp - 9));
+  time.year  = (int)(yoe + era * 400 + (time.month <= 2));
+
+  return time;
+}
+
+/**
+  * @brief  Gregorian calendar date to seconds since an epoch.
+  * @param  [in] time:  Gregorian calendar date.
+  * @param  [in] epoch: Epoch.
+  * @return Seconds since the epoch.
+  */
+long long GregorianCalendarDateToEpochSecond(DateTime time, DateTimeEpoch epoch)
+{
+  long long jdn = GregorianCalendarDateToJulianDayNumber(time);
+
+  return jdn * 86400 + time.hour * 3600LL + time.minute * 60LL + time.second - epochOffset[epoch];
+}
+
+/**
+  * @brief  Gregorian calendar date to days since an epoch.
+  * @param  [in] time:  Gregorian calendar date.
+  * @param  [in] epoch: Epoch.
+  * @return Days since the epoch, rounded toward negative infinity.
+  */
+long long GregorianCalendarDateToEpochDay(DateTime time, DateTimeEpoch epoch)
+{
+  return FloorDivide(GregorianCalendarDateToEpochSecond(time, epoch), 86400);
+}
+
+/**
+  * @brief  Seconds since an epoch to gregorian calendar date.
+  * @param  [in] second: Seconds since the epoch.
+  * @param  [in] epoch:  Epoch.
+  * @return Gregorian calendar date.
+  */
+DateTime EpochSecondToGregorianCalendarDate(long long second, DateTimeEpoch epoch)
+{
+  /* Split before adding the offset so seconds near the limits do not overflow. */
+  long long day = FloorDivide(second, 86400) + FloorDivide(epochOffset[epoch], 86400);
+  long long sod = (second - FloorDivide(second, 86400) * 86400) + epochOffset[epoch] % 86400;
+
+  if(sod >= 86400)
+  {
+    day += 1;
+    sod -= 86400;
+  }
+
+  DateTime time = JulianDayNumberToGregorianCalendarDate(day);
+
+  time.hour   = (int)(sod / 3600);
+  time.minute = (int)(sod / 60 % 60);
+  time.second = (int)(sod % 60);
+
+  return time;
+}
+
+/**
+  * @brief  Days since an epoch to gregorian calendar date.
+  * @param  [in] day:   Days since the epoch.
+  * @param  [in] epoch: Epoch.
+  * @return Gregorian calendar date, at noon for J2000.
+  */
+DateTime EpochDayToGregorianCalendarDate(long long day, DateTimeEpoch epoch)
+{
+  DateTime time = JulianDayNumberToGregorianCalendarDate(day + epochOffset[epoch] / 86400);
+
+  time.hour = (int)(epochOffset[epoch] % 86400 / 3600);
+
+  return time;
+}
+
+/**
+  * @brief  Convert seconds since one epoch to seconds since another.
+  * @param  [in] second: Seconds since the first epoch.
+  * @param  [in] from:   First epoch.
+  * @param  [in] to:     Second epoch.
+  * @return Seconds since the second epoch.
+  */
+long long EpochSecondConvert(long long second, DateTimeEpoch from, DateTimeEpoch to)
+{
+  return second + (epochOffset[from] - epochOffset[to]);
+}
+
+/**
+  * @brief  Seconds since an epoch to gps week and second.
+  * @param  [in] second: Seconds since the epoch.
+  * @param  [in] epoch:  Epoch.
+  * @return Gps week and second, the week is negative before the gps epoch.
+  * @note   The week must fit in an int, about 41 million years.
+  */
+GpsWeekSecond EpochSecondToGpsWeekSecond(long long second, DateTimeEpoch epoch)
+{
+  return GpsSecondToGpsWeekSecond(EpochSecondConvert(second, epoch, DATETIME_EPOCH_GPS));
+}
+
+/**
+  * @brief  Gps week and second to seconds since an epoch.
+  * @param  [in] time:  Gps week and second.
+  * @param  [in] epoch: Epoch.
+  * @return Seconds since the epoch.
+  */
+long long GpsWeekSecondToEpochSecond(GpsWeekSecond time, DateTimeEpoch epoch)
+{
+  return EpochSecondConvert(GpsWeekSecondToGpsSecond(time), DATETIME_EPOCH_GPS, epoch);
+}
+
+/**
+  * @brief  Julian day number with 32-bit unsigned arithmetic.
+  * @param  [in] year:  Year, DATETIME_WIDE_FAST_YEAR_MIN to DATETIME_WIDE_FAST_YEAR_MAX.
+  * @param  [in] month: Month.
+  * @param  [in] day:   Day.
+  * @return Julian day number.
+  */
+static long long FastJulianDayNumber(int year, int month, int day)
+{
+  unsigned int y   = (unsigned int)year - (month <= 2);
+  unsigned int m   = (month > 2) ? (unsigned int)(month - 3) : (unsigned int)(month + 9);
+  unsigned int era = y / 400;
+  unsigned int yoe = y - era * 400;
+  unsigned int doe = yoe * 365 + yoe / 4 - yoe / 100 + (153 * m + 2) / 5 + (unsigned int)day - 1;
+
+  return (long long)(era * 146097 + doe) + CIVIL_EPOCH_JDN;
+}
+
+/**
+  * @brief  Gregorian calendar date with 32-bit unsigned arithmetic.
+  * @param  [in] day: Days since 0000-03-01, up to the end of DATETIME_WIDE_FAST_YEAR_MAX.
+  * @return Gregorian calendar date at the start of the day.
+  */
+static DateTime FastGregorianCalendarDate(unsigned int day)
+{
+  unsigned int era = day / 146097;
+  unsigned int doe = day - era * 146097;
+  unsigned int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  unsigned int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  unsigned int mp  = (5 * doy + 2) / 153;
+
+  DateTime time = {0};
+
+  time.day   = (int)(doy - (153 * mp + 2) / 5 + 1);
+  time.month = (int)((mp < 10) ? (mp + 3) : (mp - 9));
+  time.year  = (int)(yoe + era * 400) + (time.month <= 2);
+
+  return time;
+}
@@ -0,0 +1,81 @@
+/**
+  ******************************************************************************
+  * @file    DateTimeWide.h
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Header file for DateTimeWide.c module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+
+#ifndef __DATETIMEWIDE_H
+#define __DATETIMEWIDE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Header includes -----------------------------------------------------------*/
+#include "DateTime.h"
+
+/* Macro definitions ---------------------------------------------------------*/
+#define DATETIME_WIDE_FAST_YEAR_MIN (1)       /*!< Years the 32-bit kernels handle. */
+#define DATETIME_WIDE_FAST_YEAR_MAX (1000000)
+
+/* Type definitions ----------------------------------------------------------*/
+
+/*
+ * Epochs for 64-bit second and day counts. Counts are plain calendar
+ * arithmetic without leap seconds, in whatever time scale the caller uses.
+ * Days are counted from the epoch and rounded toward negative infinity, so
+ * J2000 days start at noon.
+ */
+typedef enum
+{
+  DATETIME_EPOCH_GPS = 0, /*!< 1980-01-06 00:00:00. */
+  DATETIME_EPOCH_UNIX,    /*!< 1970-01-01 00:00:00. */
+  DATETIME_EPOCH_J2000,   /*!< 2000-01-01 12:00:00, julian date 2451545.0. */
+  DATETIME_EPOCH_MJD      /*!< 1858-11-17 00:00:00, modified julian date 0. */
+}DateTimeEpoch;
+
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+long long GregorianCalendarDateToJulianDayNumber(DateTime time);
+DateTime JulianDayNumberToGregorianCalendarDate(long long jdn);
+
+long long GregorianCalendarDateToEpochSecond(DateTime time, DateTimeEpoch epoch);
+long long GregorianCalendarDateToEpochDay(DateTime time, DateTimeEpoch epoch);
+DateTime EpochSecondToGregorianCalendarDate(long long second, DateTimeEpoch epoch);
+DateTime EpochDayToGregorianCalendarDate(long long day, DateTimeEpoch epoch);
+
+long long EpochSecondConvert(long long second, DateTimeEpoch from, DateTimeEpoch to);
+GpsWeekSecond EpochSecondToGpsWeekSecond(long long second, DateTimeEpoch epoch);
+long long GpsWeekSecondToEpochSecond(GpsWeekSecond time, DateTimeEpoch epoch);
+
+/* Function definitions ------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DATETIMEWIDE_H */
@@ -0,0 +1,190 @@
+/**
+  ******************************************************************************
+  * @file    GpsWeekRollover.c
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Resolve truncated gps week numbers to full week numbers.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+/* Header includes -----------------------------------------------------------*/
+#include "GpsWeekRollover.h"
+#include "DateTimeCommon.h"
+
+/* Macro definitions ---------------------------------------------------------*/
+/* Type definitions ----------------------------------------------------------*/
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+/* Function definitions ------------------------------------------------------*/
+
+/**
+  * @brief  Resolve a truncated gps week to the full week nearest to a reference.
+  * @param  [in] week:      Truncated gps week, 0 to modulus - 1.
+  * @param  [in] modulus:   Week modulus, GPS_WEEK_MODULUS_LNAV or GPS_WEEK_MODULUS_CNAV.
+  * @param  [in] reference: Gps week and second known to be within half a cycle of the data.
+  * @return Full gps week, the week unchanged if the modulus is not positive.
+  */
+int GpsWeekRolloverResolve(int week, int modulus, GpsWeekSecond reference)
+{
+  if(modulus <= 0)
+  {
+    return week;
+  }
+
+  int distance = reference.week - week + modulus / 2;
+  int cycle    = distance / modulus;
+
+  if((distance % modulus) < 0)
+  {
+    cycle -= 1;
+  }
+
+  return week + cycle * modulus;
+}
+
+/**
+  * @brief  Initialize a streaming rollover resolver.
+  * @param  [out] rollover:  Resolver state.
+  * @param  [in]  modulus:   Week modulus, GPS_WEEK_MODULUS_LNAV or GPS_WEEK_MODULUS_CNAV.
+  * @param  [in]  reference: Gps week and second within half a cycle of the first record.
+  * @param  [in]  threshold: Largest forward step in seconds not flagged as a jump, 0 to disable.
+  * @return 0 on success, -1 if the modulus is not positive.
+  * @note   On failure the modulus is set to 0, so every record is flagged
+  *         GPS_WEEK_ROLLOVER_INVALID and left as is.
+  */
+int GpsWeekRolloverInit(GpsWeekRollover *rollover, int modulus, GpsWeekSecond reference, int threshold)
+{
+  rollover->modulus   = (modulus > 0) ? modulus : 0;
+  rollover->base      = 0;
+  rollover->week      = -1;
+  rollover->threshold = threshold;
+  rollover->last      = GpsWeekSecondToGpsSecond(reference);
+
+  return (modulus > 0) ? 0 : -1;
+}
+
+/**
+  * @brief  Resolve the next record of a stream.
+  * @param  [in,out] rollover: Resolver state.
+  * @param  [in]     time:     Gps week and second with a truncated week.
+  * @param  [out]    flag:     GPS_WEEK_ROLLOVER_xxx bits, may be NULL.
+  * @return Gps week and second with the full week.
+  * @note   After the first record the cycle is carried in the state, so a
+  *         record costs a compare and an add. A step of more than half a
+  *         cycle in the truncated week is taken as a wrap.
+  */
+GpsWeekSecond GpsWeekRolloverUpdate(GpsWeekRollover *rollover, GpsWeekSecond time, int *flag)
+{
+  int state = 0;
+
+  if((time.week < 0) || (time.week >= rollover->modulus))
+  {
+    if(flag != NULL)
+    {
+      *flag = GPS_WEEK_ROLLOVER_INVALID;
+    }
+
+    return time;
+  }
+
+  int first = (rollover->week < 0);
+
+  if(first)
+  {
+    GpsWeekSecond reference = {.week = (int)(rollover->last / 604800), .second = 0};
+
+    rollover->base = GpsWeekRolloverResolve(time.week, rollover->modulus, reference) - time.week;
+  }
+  else
+  {
+    int delta = time.week - rollover->week;
+
+    if(delta < -(rollover->modulus / 2))
+    {
+      rollover->base += rollover->modulus;
+      state          |= GPS_WEEK_ROLLOVER_WRAP;
+    }
+    else if(delta > (rollover->modulus / 2))
+    {
+      rollover->base -= rollover->modulus;
+    }
+  }
+
+  rollover->week = time.week;
+  time.week     += rollover->base;
+
+  long long epoch = GpsWeekSecondToGpsSecond(time);
+
+  if(!first)
+  {
+    if(epoch < rollover->last)
+    {
+      state |= GPS_WEEK_ROLLOVER_BACKWARD;
+    }
+    else if((rollover->threshold > 0) && ((epoch - rollover->last) > rollover->threshold))
+    {
+      state |= GPS_WEEK_ROLLOVER_JUMP;
+    }
+  }
+
+  rollover->last = epoch;
+
+  if(flag != NULL)
+  {
+    *flag = state;
+  }
+
+  return time;
+}
+
+/**
+  * @brief  Resolve an array of records in place.
+  * @param  [in,out] rollover: Resolver state, carried over between calls.
+  * @param  [in,out] time:     Gps week and second with truncated weeks.
+  * @param  [in]     size:     The number of records.
+  * @param  [out]    flag:     GPS_WEEK_ROLLOVER_xxx bits of each record, may be NULL.
+  * @return The number of records flagged as jump, backward or invalid.
+  */
+size_t GpsWeekRolloverUpdateArray(GpsWeekRollover *rollover, GpsWeekSecond *time, size_t size, unsigned char *flag)
+{
+  size_t count = 0;
+
+  for(size_t i = 0; i < size; i++)
+  {
+    int state = 0;
+
+    time[i] = GpsWeekRolloverUpdate(rollover, time[i], &state);
+
+    if(state & (GPS_WEEK_ROLLOVER_JUMP | GPS_WEEK_ROLLOVER_BACKWARD | GPS_WEEK_ROLLOVER_INVALID))
+    {
+      count++;
+    }
+
+    if(flag != NULL)
+    {
+      flag[i] = (unsigned char)state;
+    }
+  }
+
+  return count;
+}
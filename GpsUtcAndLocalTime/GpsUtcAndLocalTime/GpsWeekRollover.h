@@ -0,0 +1,74 @@
+/**
+  ******************************************************************************
+  * @file    GpsWeekRollover.h
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Header file for GpsWeekRollover.c module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+#ifndef __GPSWEEKROLLOVER_H
+#define __GPSWEEKROLLOVER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Header includes -----------------------------------------------------------*/
+#include "DateTime.h"
+#include <stddef.h>
+
+/* Macro definitions ---------------------------------------------------------*/
+#define GPS_WEEK_MODULUS_LNAV       (1024) /*!< 10-bit week of the legacy navigation message. */
+#define GPS_WEEK_MODULUS_CNAV       (8192) /*!< 13-bit week of the civil navigation message. */
+
+#define GPS_WEEK_ROLLOVER_WRAP      (0x01) /*!< The truncated week wrapped around. */
+#define GPS_WEEK_ROLLOVER_JUMP      (0x02) /*!< Time stepped forward more than the threshold. */
+#define GPS_WEEK_ROLLOVER_BACKWARD  (0x04) /*!< Time went backward, e.g. a receiver reset. */
+#define GPS_WEEK_ROLLOVER_INVALID   (0x08) /*!< The week is not below the modulus, left as is. */
+
+/* Type definitions ----------------------------------------------------------*/
+typedef struct
+{
+  int       modulus;   /*!< Week modulus of the receiver. */
+  int       base;      /*!< Full week of truncated week 0 in the current cycle. */
+  int       week;      /*!< Truncated week of the last record, -1 before the first. */
+  int       threshold; /*!< Largest forward step in seconds not flagged as a jump. */
+  long long last;      /*!< Last resolved epoch, seconds since the gps epoch. */
+}GpsWeekRollover;
+
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+int GpsWeekRolloverResolve(int week, int modulus, GpsWeekSecond reference);
+
+int GpsWeekRolloverInit(GpsWeekRollover *rollover, int modulus, GpsWeekSecond reference, int threshold);
+GpsWeekSecond GpsWeekRolloverUpdate(GpsWeekRollover *rollover, GpsWeekSecond time, int *flag);
+size_t GpsWeekRolloverUpdateArray(GpsWeekRollover *rollover, GpsWeekSecond *time, size_t size, unsigned char *flag);
+
+/* Function definitions ------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GPSWEEKROLLOVER_H */
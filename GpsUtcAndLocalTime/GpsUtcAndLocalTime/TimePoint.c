@@ -0,0 +1,254 @@
+/**
+  ******************************************************************************
+  * @file    TimePoint.c
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Gps time point with lazily decoded calendar date.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+/* Header includes -----------------------------------------------------------*/
+#include "TimePoint.h"
+#include "DateTimeCommon.h"
+#include "DateTimeWide.h"
+#include <math.h>
+
+/* Macro definitions ---------------------------------------------------------*/
+#define CACHE_YEAR_SHIFT   (1)
+#define CACHE_MONTH_SHIFT  (17)
+#define CACHE_DAY_SHIFT    (21)
+#define CACHE_YEAR_BIAS    (32768)
+
+/* Type definitions ----------------------------------------------------------*/
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+static unsigned long long DecodeDate(TimePoint *time);
+
+/* Function definitions ------------------------------------------------------*/
+
+/**
+  * @brief  Time point from seconds since the gps epoch.
+  * @param  [in] second: Seconds since the gps epoch.
+  * @return Time point.
+  */
+TimePoint TimePointFromGpsSecond(long long second)
+{
+  TimePoint time = {0};
+
+  time.second = second;
+
+  return time;
+}
+
+/**
+  * @brief  Time point from gps week and second.
+  * @param  [in] time: Gps week and second.
+  * @return Time point.
+  */
+TimePoint TimePointFromGpsWeekSecond(GpsWeekSecond time)
+{
+  return TimePointFromGpsSecond(GpsWeekSecondToGpsSecond(time));
+}
+
+/**
+  * @brief  Time point from gregorian calendar date.
+  * @param  [in] time: Gregorian calendar date.
+  * @return Time point.
+  */
+TimePoint TimePointFromGregorianCalendarDate(DateTime time)
+{
+  return TimePointFromGpsSecond(GregorianCalendarDateToEpochSecond(time, DATETIME_EPOCH_GPS));
+}
+
+/**
+  * @brief  Time point from julian date.
+  * @param  [in] jd: Julian date.
+  * @return Time point, rounded to the nearest second.
+  */
+TimePoint TimePointFromJulianDate(double jd)
+{
+  return TimePointFromGpsSecond((long long)floor((jd - GPS_EPOCH_JD) * 86400.0 + 0.5));
+}
+
+/**
+  * @brief  Time point from modified julian date.
+  * @param  [in] mjd: Modified julian date.
+  * @return Time point, rounded to the nearest second.
+  */
+TimePoint TimePointFromModifiedJulianDate(double mjd)
+{
+  return TimePointFromGpsSecond((long long)floor((mjd - GPS_EPOCH_MJD) * 86400.0 + 0.5));
+}
+
+/**
+  * @brief  Time point add second.
+  * @param  [in] time:   Time point.
+  * @param  [in] second: The number of second to add.
+  * @return Time point, the cached date is kept while the day does not change.
+  */
+TimePoint TimePointAddSecond(TimePoint time, long long second)
+{
+  long long day = FloorDivide(time.second, 86400);
+
+  time.second += second;
+
+  if(FloorDivide(time.second, 86400) != day)
+  {
+    time.cache = 0;
+  }
+
+  return time;
+}
+
+/**
+  * @brief  Time point to gregorian calendar date.
+  * @param  [in,out] time: Time point, the date is cached on first use.
+  * @return Gregorian calendar date.
+  */
+DateTime TimePointToGregorianCalendarDate(TimePoint *time)
+{
+  unsigned long long cache = DecodeDate(time);
+  DateTime           date  = {0};
+
+  date.year   = (int)((cache >> CACHE_YEAR_SHIFT) & 0xFFFF) - CACHE_YEAR_BIAS;
+  date.month  = (int)((cache >> CACHE_MONTH_SHIFT) & 0xF);
+  date.day    = (int)((cache >> CACHE_DAY_SHIFT) & 0x1F);
+  date.hour   = TimePointHour(time);
+  date.minute = TimePointMinute(time);
+  date.second = TimePointSecond(time);
+
+  return date;
+}
+
+/**
+  * @brief  Gregorian calendar year of a time point.
+  * @param  [in,out] time: Time point, the date is cached on first use.
+  * @return Year.
+  */
+int TimePointYear(TimePoint *time)
+{
+  return (int)((DecodeDate(time) >> CACHE_YEAR_SHIFT) & 0xFFFF) - CACHE_YEAR_BIAS;
+}
+
+/**
+  * @brief  Gregorian calendar month of a time point.
+  * @param  [in,out] time: Time point, the date is cached on first use.
+  * @return Month, 1 to 12.
+  */
+int TimePointMonth(TimePoint *time)
+{
+  return (int)((DecodeDate(time) >> CACHE_MONTH_SHIFT) & 0xF);
+}
+
+/**
+  * @brief  Gregorian calendar day of a time point.
+  * @param  [in,out] time: Time point, the date is cached on first use.
+  * @return Day of month, 1 to 31.
+  */
+int TimePointDay(TimePoint *time)
+{
+  return (int)((DecodeDate(time) >> CACHE_DAY_SHIFT) & 0x1F);
+}
+
+/**
+  * @brief  Hour of a time point.
+  * @param  [in] time: Time point.
+  * @return Hour, 0 to 23.
+  */
+int TimePointHour(const TimePoint *time)
+{
+  return (int)(time->second - FloorDivide(time->second, 86400) * 86400) / 3600;
+}
+
+/**
+  * @brief  Minute of a time point.
+  * @param  [in] time: Time point.
+  * @return Minute, 0 to 59.
+  */
+int TimePointMinute(const TimePoint *time)
+{
+  return (int)(time->second - FloorDivide(time->second, 3600) * 3600) / 60;
+}
+
+/**
+  * @brief  Second of a time point.
+  * @param  [in] time: Time point.
+  * @return Second, 0 to 59.
+  */
+int TimePointSecond(const TimePoint *time)
+{
+  return (int)(time->second - FloorDivide(time->second, 60) * 60);
+}
+
+/**
+  * @brief  Time point to gps week and second.
+  * @param  [in] time: Time point.
+  * @return Gps week and second.
+  */
+GpsWeekSecond TimePointToGpsWeekSecond(const TimePoint *time)
+{
+  return GpsSecondToGpsWeekSecond(time->second);
+}
+
+/**
+  * @brief  Time point to julian date.
+  * @param  [in] time: Time point.
+  * @return Julian date.
+  */
+double TimePointToJulianDate(const TimePoint *time)
+{
+  return GPS_EPOCH_JD + time->second / 86400.0;
+}
+
+/**
+  * @brief  Time point to modified julian date.
+  * @param  [in] time: Time point.
+  * @return Modified julian date.
+  */
+double TimePointToModifiedJulianDate(const TimePoint *time)
+{
+  return GPS_EPOCH_MJD + time->second / 86400.0;
+}
+
+/**
+  * @brief  Decode the gregorian date of a time point unless it is cached.
+  * @param  [in,out] time: Time point.
+  * @return Packed date.
+  */
+static unsigned long long DecodeDate(TimePoint *time)
+{
+  if(time->cache & TIME_POINT_CACHE_CALENDAR)
+  {
+    return time->cache;
+  }
+
+  /* Integer day arithmetic, the julian date functions lose the calendar before -4712. */
+  DateTime date = EpochDayToGregorianCalendarDate(FloorDivide(time->second, 86400), DATETIME_EPOCH_GPS);
+
+  time->cache = TIME_POINT_CACHE_CALENDAR |
+                ((unsigned long long)((date.year + CACHE_YEAR_BIAS) & 0xFFFF) << CACHE_YEAR_SHIFT) |
+                ((unsigned long long)date.month << CACHE_MONTH_SHIFT) |
+                ((unsigned long long)date.day << CACHE_DAY_SHIFT);
+
+  return time->cache;
+}
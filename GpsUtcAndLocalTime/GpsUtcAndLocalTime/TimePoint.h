@@ -0,0 +1,90 @@
+/**
+  ******************************************************************************
+  * @file    TimePoint.h
+  * @author  agent
+  * @version v1.0
+  * @date    19-October-2026
+  * @brief   Header file for TimePoint.c module.
+  ******************************************************************************
+  * @attention
+  *
+  * <h2><center>Copyright &copy; 2026 agent</center></h2>
+  *
+  * This program is free software: you can redistribute it and/or modify
+  * it under the terms of the GNU General Public License as published by
+  * the Free Software Foundation, either version 3 of the License, or
+  * (at your option) any later version.
+  *
+  * This program is distributed in the hope that it will be useful,
+  * but WITHOUT ANY WARRANTY; without even the implied warranty of
+  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  * GNU General Public License for more details.
+  *
+  * You should have received a copy of the GNU General Public License
+  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+  *
+  ******************************************************************************
+  */
+
+
+#ifndef __TIMEPOINT_H
+#define __TIMEPOINT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Header includes -----------------------------------------------------------*/
+#include "DateTime.h"
+
+/* Macro definitions ---------------------------------------------------------*/
+#define TIME_POINT_CACHE_CALENDAR (0x1ULL) /*!< Gregorian date is cached. */
+
+/* Type definitions ----------------------------------------------------------*/
+
+/*
+ * A point in gps time held as one integer, with the gregorian date decoded
+ * on first access and cached next to it. Time of day, gps week, julian date
+ * and modified julian date are a division away and are not cached.
+ * 16 bytes, so it is passed in two registers where the abi allows it.
+ *
+ * Cache bits: 0 valid mask, 1-16 year + 32768, 17-20 month, 21-25 day,
+ * so dates are correct for years -32768 to 32767 of the proleptic gregorian
+ * calendar; years outside wrap in the cache.
+ */
+typedef struct
+{
+  long long          second; /*!< Seconds since the gps epoch. */
+  unsigned long long cache;  /*!< Packed date and valid mask. */
+}TimePoint;
+
+/* Variable declarations -----------------------------------------------------*/
+/* Variable definitions ------------------------------------------------------*/
+/* Function declarations -----------------------------------------------------*/
+TimePoint TimePointFromGpsSecond(long long second);
+TimePoint TimePointFromGpsWeekSecond(GpsWeekSecond time);
+TimePoint TimePointFromGregorianCalendarDate(DateTime time);
+TimePoint TimePointFromJulianDate(double jd);
+TimePoint TimePointFromModifiedJulianDate(double mjd);
+
+TimePoint TimePointAddSecond(TimePoint time, long long second);
+
+DateTime TimePointToGregorianCalendarDate(TimePoint *time);
+int TimePointYear(TimePoint *time);
+int TimePointMonth(TimePoint *time);
+int TimePointDay(TimePoint *time);
+int TimePointHour(const TimePoint *time);
+int TimePointMinute(const TimePoint *time);
+int TimePointSecond(const TimePoint *time);
+
+GpsWeekSecond TimePointToGpsWeekSecond(const TimePoint *time);
+double TimePointToJulianDate(const TimePoint *time);
+double TimePointToModifiedJulianDate(const TimePoint *time);
+
+/* Function definitions ------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TIMEPOINT_H */
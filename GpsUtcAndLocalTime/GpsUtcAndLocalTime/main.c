@@ -27,18 +27,48 @@
   */
 
 /* Header includes -----------------------------------------------------------*/
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "Dashboard.h"
 #include "DateTime.h"
-#include <stdint.h>
+#include "DateTimeNow.h"
 #include <stdio.h>
-#include <time.h>
+
+#if defined(_WIN32)
 #include <windows.h>
+#else
+#include <time.h>
+#endif
 
 /* Macro definitions ---------------------------------------------------------*/
+#define REFRESH_INTERVAL (50)   /*!< Milliseconds between frames. */
+#define BDT_GPS_OFFSET   (-14)  /*!< BDT - GPS seconds. */
+#define BDT_GPS_WEEK     (1356) /*!< GPS week of the BDT epoch. */
+#define GST_GPS_WEEK     (1024) /*!< GPS week of the GST epoch. */
+
 /* Type definitions ----------------------------------------------------------*/
+typedef struct
+{
+  const char *name;
+  int         offset; /*!< Hours east of UTC. */
+}TimeZone;
+
 /* Variable declarations -----------------------------------------------------*/
 /* Variable definitions ------------------------------------------------------*/
+static const TimeZone timeZone[] =
+{
+  {"UTC-5", -5},
+  {"UTC+1",  1},
+  {"UTC+8",  8},
+  {"UTC+9",  9}
+};
+
+static Dashboard dashboard;
+
 /* Function declarations -----------------------------------------------------*/
-static void gotoxy(int x, int y);
+static void SleepMillisecond(int millisecond);
 
 /* Function definitions ------------------------------------------------------*/
 
@@ -49,61 +79,77 @@ static void gotoxy(int x, int y);
   */
 int main(void)
 {
+  DashboardInit(&dashboard);
+
   for(;;)
   {
-    time_t        times     = 0;
-    double        mjd       = 0.0;
-    DateTime      utctime   = {.year = 1970, .month = 1, .day = 1, .hour = 0, .minute = 0, .second = 0};
-    DateTime      localtime = {.year = 1970, .month = 1, .day = 1, .hour = 8, .minute = 0, .second = 0};
-    DateTime      gpstime   = {.year = 1970, .month = 1, .day = 1, .hour = 0, .minute = 0, .second = 0};
-    GpsWeekSecond gpstimews = {0};
+    NowTime       now       = {0};
+    DateTime      bdttime   = {0};
+    GpsWeekSecond bdttimews = {0};
+    int           row       = 0;
 
-    time(&times);
+    NowTimeRead(&now);
 
-    if(times > INT32_MAX)
-    {
-      utctime = GregorianCalendarDateAddSecond(utctime, INT32_MAX);
-      utctime = GregorianCalendarDateAddSecond(utctime, (int)(times - INT32_MAX));
-    }
-    else
+    bdttime   = GregorianCalendarDateAddSecond(now.gps, BDT_GPS_OFFSET);
+    bdttimews = GregorianCalendarDateToGpsWeekSecond(bdttime);
+
+    for(size_t i = 0; i < sizeof(timeZone) / sizeof(timeZone[0]); i++)
     {
-      utctime = GregorianCalendarDateAddSecond(utctime, (int)times);
+      DateTime localtime = GregorianCalendarDateAddHour(now.utc, timeZone[i].offset);
+
+      DashboardPrint(&dashboard, row++, "Local | %d-%.2d-%.2d %.2d:%.2d:%.2d | timezone %s",
+                     localtime.year, localtime.month, localtime.day,
+                     localtime.hour, localtime.minute, localtime.second,
+                     timeZone[i].name);
     }
 
-    mjd       = GregorianCalendarDateToModifiedJulianDate(utctime);
-    localtime = GregorianCalendarDateAddHour(utctime, 8);
-    gpstime   = GregorianCalendarDateAddSecond(utctime, 18);
-    gpstimews = GregorianCalendarDateToGpsWeekSecond(gpstime);
+    DashboardPrint(&dashboard, row++, "UTC   | %d-%.2d-%.2d %.2d:%.2d:%.2d.%.3ld | MJD %.5f",
+                   now.utc.year, now.utc.month, now.utc.day,
+                   now.utc.hour, now.utc.minute, now.utc.second,
+                   now.nanosecond / 1000000, now.mjd);
 
-    gotoxy(0, 0);
+    DashboardPrint(&dashboard, row++, "TAI   | %d-%.2d-%.2d %.2d:%.2d:%.2d",
+                   now.tai.year, now.tai.month, now.tai.day,
+                   now.tai.hour, now.tai.minute, now.tai.second);
 
-    printf("Local | %d-%.2d-%.2d %.2d:%.2d:%.2d | timezone UTC+8\n",
-           localtime.year, localtime.month, localtime.day,
-           localtime.hour, localtime.minute, localtime.second);
+    DashboardPrint(&dashboard, row++, "GPS   | %d-%.2d-%.2d %.2d:%.2d:%.2d | week %d %d s",
+                   now.gps.year, now.gps.month, now.gps.day,
+                   now.gps.hour, now.gps.minute, now.gps.second,
+                   now.gpsWeekSecond.week, now.gpsWeekSecond.second);
 
-    printf("UTC   | %d-%.2d-%.2d %.2d:%.2d:%.2d | MJD %.5f\n",
-           utctime.year, utctime.month, utctime.day,
-           utctime.hour, utctime.minute, utctime.second,
-           mjd);
+    DashboardPrint(&dashboard, row++, "BDT   | %d-%.2d-%.2d %.2d:%.2d:%.2d | week %d %d s",
+                   bdttime.year, bdttime.month, bdttime.day,
+                   bdttime.hour, bdttime.minute, bdttime.second,
+                   bdttimews.week - BDT_GPS_WEEK, bdttimews.second);
 
-    printf("GPS   | %d-%.2d-%.2d %.2d:%.2d:%.2d | week %d %d s\n",
-           gpstime.year, gpstime.month, gpstime.day,
-           gpstime.hour, gpstime.minute, gpstime.second,
-           gpstimews.week, gpstimews.second);
+    DashboardPrint(&dashboard, row++, "GST   | %d-%.2d-%.2d %.2d:%.2d:%.2d | week %d %d s",
+                   now.gps.year, now.gps.month, now.gps.day,
+                   now.gps.hour, now.gps.minute, now.gps.second,
+                   now.gpsWeekSecond.week - GST_GPS_WEEK, now.gpsWeekSecond.second);
 
-    Sleep(100);
+    DashboardPrint(&dashboard, row++, "MJD   | %.9f", now.mjd);
+
+    DashboardPrint(&dashboard, row++, "Frame | %d bytes | %.1f us",
+                   (int)dashboard.bytes, dashboard.renderTime * 1000000.0);
+
+    DashboardRender(&dashboard);
+
+    SleepMillisecond(REFRESH_INTERVAL);
   }
 }
 
 /**
-  * @brief  Move the cursor to the specified position on the text screen.
-  * @param  [in] x: X axis coordinates.
-  * @param  [in] y: Y axis coordinates.
+  * @brief  Suspend the program for a while.
+  * @param  [in] millisecond: Milliseconds to sleep.
   * @return None.
   */
-static void gotoxy(int x, int y)
+static void SleepMillisecond(int millisecond)
 {
-  COORD  pos  = {x, y};
-  HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
-  SetConsoleCursorPosition(hOut, pos);
+#if defined(_WIN32)
+  Sleep(millisecond);
+#else
+  struct timespec interval = {.tv_sec = millisecond / 1000, .tv_nsec = millisecond % 1000 * 1000000L};
+
+  nanosleep(&interval, NULL);
+#endif
 }